@@ -0,0 +1,248 @@
+/*
+
+GlkApi benchmarks
+=================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+/*
+
+Run with `cargo bench`, optionally followed by a substring of the benchmarks to run.
+
+This uses a small harness of its own rather than the unstable built in one: each benchmark is calibrated to take about 10ms per sample, and the median and fastest of 25 samples are reported. fixtures/transcript.jsonl is a recorded session: GlkOte events, each followed by an `{"output": ...}` record of what the game printed in response.
+
+*/
+
+use std::hint::black_box;
+use std::time::{Duration, Instant};
+
+use remglk::glkapi::arena::UpdateArena;
+use remglk::glkapi::constants::{FileMode, SeekMode};
+use remglk::glkapi::deserialise::Deserialiser;
+use remglk::glkapi::json::{self, JsonReader, JsonWriter};
+use remglk::glkapi::msgpack::MessagePackWriter;
+use remglk::glkapi::protocol::*;
+use remglk::glkapi::streams::{ArrayBackedStream, Stream};
+use remglk::glkapi::windows::buffer::BufferWindowText;
+use remglk::glkapi::GlkArray;
+
+const SAMPLES: usize = 25;
+const SAMPLE_TIME: Duration = Duration::from_millis(10);
+const TRANSCRIPT: &str = include_str!("fixtures/transcript.jsonl");
+
+struct Bencher {
+    filter: Option<String>,
+}
+
+impl Bencher {
+    fn bench<T>(&self, name: &str, mut f: impl FnMut() -> T) {
+        if self.filter.as_ref().is_some_and(|filter| !name.contains(filter.as_str())) {
+            return;
+        }
+        let mut iters = 1;
+        loop {
+            let start = Instant::now();
+            for _ in 0..iters {
+                black_box(f());
+            }
+            if start.elapsed() >= SAMPLE_TIME {
+                break;
+            }
+            iters *= 2;
+        }
+        let mut samples: Vec<f64> = (0..SAMPLES).map(|_| {
+            let start = Instant::now();
+            for _ in 0..iters {
+                black_box(f());
+            }
+            start.elapsed().as_nanos() as f64 / iters as f64
+        }).collect();
+        samples.sort_by(|a, b| a.total_cmp(b));
+        println!("{:<40} {:>12} {:>12}", name, format_ns(samples[SAMPLES / 2]), format_ns(samples[0]));
+    }
+}
+
+fn format_ns(ns: f64) -> String {
+    if ns >= 1_000_000.0 {
+        format!("{:.2} ms", ns / 1_000_000.0)
+    }
+    else if ns >= 1_000.0 {
+        format!("{:.2} µs", ns / 1_000.0)
+    }
+    else {
+        format!("{:.1} ns", ns)
+    }
+}
+
+/** The transcript's events, and each turn's output */
+fn load_transcript() -> (Vec<&'static str>, Vec<String>) {
+    let mut events = Vec::new();
+    let mut outputs = Vec::new();
+    for line in TRANSCRIPT.lines() {
+        if line.starts_with("{\"output\"") {
+            let mut reader = JsonReader::new(line);
+            reader.begin_object().unwrap();
+            reader.next_key().unwrap();
+            outputs.push(reader.str().unwrap().into_owned());
+        }
+        else {
+            events.push(line);
+        }
+    }
+    (events, outputs)
+}
+
+/** Build one turn's update, as a game printing into a single buffer window would */
+fn turn_update(window: &mut BufferWindowText, arena: &mut UpdateArena, gen: u32, output: &str) -> Update<String> {
+    window.put_str(output);
+    window.set_style(Style::Input);
+    window.put_str("> ");
+    window.set_style(Style::Normal);
+    Update::StateUpdate(StateUpdate {
+        autorestore: None,
+        content: window.take_update(1, arena).map(|update| {
+            let mut content = arena.content();
+            content.push(ContentUpdate::BufferWindowContentUpdate(update));
+            content
+        }),
+        debugoutput: None,
+        disable: None,
+        gen,
+        input: Some({
+            let mut inputs = arena.inputs();
+            inputs.push(InputUpdate {
+                gen: Some(gen),
+                hyperlink: None,
+                id: 1,
+                initial: None,
+                maxlen: Some(255),
+                mouse: None,
+                terminators: None,
+                type_: Some(TextInputType::Line),
+                xpos: None,
+                ypos: None,
+            });
+            inputs
+        }),
+        page_margin_bg: None,
+        specialinput: None,
+        timer: None,
+        windows: None,
+    })
+}
+
+fn bench_arrays(b: &Bencher) {
+    const LEN: usize = 4096;
+    let mut src_u8: Vec<u8> = (0..LEN).map(|i| b'a' + (i % 26) as u8).collect();
+    let mut src_u32: Vec<u32> = (0..LEN).map(|i| 0xA0 + (i % 0x80) as u32).collect();
+    let mut dest_u8 = vec![0u8; LEN];
+    let mut dest_u32 = vec![0u32; LEN];
+
+    let src = GlkArray::U8(&mut src_u8);
+    let mut dest = GlkArray::U8(&mut dest_u8);
+    b.bench("set_slice/u8_to_u8", || dest.set_slice(&src, 0, 0, LEN));
+    let mut dest = GlkArray::U32(&mut dest_u32);
+    b.bench("set_slice/u8_to_u32", || dest.set_slice(&src, 0, 0, LEN));
+    let src = GlkArray::U32(&mut src_u32);
+    b.bench("set_slice/u32_to_u32", || dest.set_slice(&src, 0, 0, LEN));
+    let mut dest = GlkArray::U8(&mut dest_u8);
+    b.bench("set_slice/u32_to_u8", || dest.set_slice(&src, 0, 0, LEN));
+
+    let ascii = "You are standing in an open field west of a white house. ".repeat(64);
+    let latin1 = "Le garçon a mangé une crème brûlée près de la fenêtre. ".repeat(64);
+    let cjk = "你站在一座白色房子西边的空地上。前门被木板封住了。".repeat(64);
+    for (name, str) in [("ascii", &ascii), ("latin1", &latin1), ("cjk", &cjk)] {
+        let mut arr = vec![0u32; str.chars().count()];
+        let mut dest = GlkArray::U32(&mut arr);
+        b.bench(&format!("set_str/{}_to_u32", name), || dest.set_str(0, str));
+        let mut arr = vec![0u8; str.chars().count()];
+        let mut dest = GlkArray::U8(&mut arr);
+        b.bench(&format!("set_str/{}_to_u8", name), || dest.set_str(0, str));
+    }
+}
+
+fn bench_streams(b: &Bencher) {
+    let (_, outputs) = load_transcript();
+    let text: String = outputs.concat();
+    let len = text.chars().count();
+
+    let mut arr = vec![0u8; len];
+    let mut stream = ArrayBackedStream::new(&mut arr, FileMode::Write, 0, None);
+    b.bench("stream/put_string_u8", || {
+        stream.set_position(SeekMode::Start, 0);
+        stream.put_string(&text, None);
+    });
+    let mut arr = vec![0u32; len];
+    let mut stream = ArrayBackedStream::new(&mut arr, FileMode::Write, 0, None);
+    b.bench("stream/put_string_u32", || {
+        stream.set_position(SeekMode::Start, 0);
+        stream.put_string(&text, None);
+    });
+
+    let mut arr = text.chars().map(|ch| ch as u32).collect::<Vec<u32>>();
+    let mut stream = ArrayBackedStream::new(&mut arr, FileMode::Read, 0, None);
+    b.bench("stream/get_char_u32", || {
+        stream.set_position(SeekMode::Start, 0);
+        let mut sum = 0u32;
+        loop {
+            let ch = stream.get_char(true);
+            if ch < 0 {
+                break sum;
+            }
+            sum = sum.wrapping_add(ch as u32);
+        }
+    });
+    let mut line = vec![0u32; 256];
+    b.bench("stream/get_line_u32", || {
+        stream.set_position(SeekMode::Start, 0);
+        let mut buf = GlkArray::U32(&mut line);
+        let mut lines = 0;
+        while stream.get_line(&mut buf) > 0 {
+            lines += 1;
+        }
+        lines
+    });
+}
+
+fn bench_protocol(b: &Bencher) {
+    let (events, outputs) = load_transcript();
+    b.bench("protocol/parse_events_json", || {
+        events.iter().map(|event| json::parse_event(event).unwrap().base().gen).sum::<u32>()
+    });
+
+    let mut window = BufferWindowText::new();
+    let mut arena = UpdateArena::new();
+    b.bench("protocol/build_updates", || {
+        outputs.iter().enumerate().map(|(gen, output)| turn_update(&mut window, &mut arena, gen as u32, output)).count()
+    });
+    b.bench("protocol/build_updates_recycled", || {
+        for (gen, output) in outputs.iter().enumerate() {
+            let update = turn_update(&mut window, &mut arena, gen as u32, output);
+            arena.reclaim(update);
+        }
+    });
+
+    let updates: Vec<Update<String>> = outputs.iter().enumerate().map(|(gen, output)| turn_update(&mut window, &mut arena, gen as u32, output)).collect();
+    let mut writer = JsonWriter::new();
+    b.bench("protocol/serialise_updates_json", || {
+        updates.iter().map(|update| writer.write(update).len()).sum::<usize>()
+    });
+    let mut writer = MessagePackWriter::new();
+    b.bench("protocol/serialise_updates_msgpack", || {
+        updates.iter().map(|update| writer.write(update).len()).sum::<usize>()
+    });
+}
+
+fn main() {
+    // Cargo passes `--bench`, and perhaps other flags, which we ignore
+    let filter = std::env::args().skip(1).find(|arg| !arg.starts_with('-'));
+    let b = Bencher {filter};
+    println!("{:<40} {:>12} {:>12}", "benchmark", "median", "fastest");
+    bench_arrays(&b);
+    bench_streams(&b);
+    bench_protocol(&b);
+}
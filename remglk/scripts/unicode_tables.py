@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+
+# Generate remglk/src/glkapi/unicode/tables.rs from Python's Unicode database
+#
+# Copyright (c) 2022 Dannii Willis
+# MIT licenced
+# https://github.com/curiousdannii/remglk-rs
+#
+# Usage: python3 remglk/scripts/unicode_tables.py > remglk/src/glkapi/unicode/tables.rs
+
+import unicodedata
+
+SHIFT = 7
+BLOCK = 1 << SHIFT
+MULTI = 0x4000_0000
+
+HANGUL_START = 0xAC00
+HANGUL_END = 0xD7A4
+
+def two_level(name, values, kind):
+    '''Split values into deduplicated blocks, returning the Rust source'''
+    blocks = []
+    block_ids = {}
+    index = []
+    for start in range(0, len(values), BLOCK):
+        block = tuple(values[start:start + BLOCK])
+        block += (0,) * (BLOCK - len(block))
+        if block not in block_ids:
+            block_ids[block] = len(blocks)
+            blocks.append(block)
+        index.append(block_ids[block])
+    assert len(blocks) < 1 << 16
+    out = []
+    out.append(f'pub const {name}_LIMIT: u32 = 0x{len(index) << SHIFT:X};\n')
+    out.append(array(f'{name}_INDEX', 'u16', index))
+    out.append(array(f'{name}_BLOCKS', kind, [val for block in blocks for val in block]))
+    return ''.join(out)
+
+def array(name, kind, values):
+    lines = []
+    for i in range(0, len(values), 16):
+        lines.append('    ' + ', '.join(str(val) for val in values[i:i + 16]) + ',')
+    return f'pub static {name}: [{kind}; {len(values)}] = [\n' + '\n'.join(lines) + '\n];\n'
+
+def case_tables():
+    sequences = [0]
+    sequence_ids = {}
+    def encode(ch, mapped):
+        if len(mapped) == 1:
+            return ord(mapped) - ch
+        if mapped not in sequence_ids:
+            sequence_ids[mapped] = len(sequences)
+            sequences.append(len(mapped))
+            sequences.extend(ord(c) for c in mapped)
+        return MULTI | sequence_ids[mapped]
+    records = [(0, 0, 0)]
+    record_ids = {(0, 0, 0): 0}
+    values = []
+    limit = max(ch for ch in range(0x110000) if not is_uncased(ch)) + 1
+    for ch in range(limit):
+        c = chr(ch)
+        record = (encode(ch, c.lower()), encode(ch, c.upper()), encode(ch, c.title()))
+        if record not in record_ids:
+            record_ids[record] = len(records)
+            records.append(record)
+        values.append(record_ids[record])
+    out = [two_level('CASE', values, 'u16')]
+    out.append(f'pub static CASE_RECORDS: [[i32; 3]; {len(records)}] = [\n')
+    for record in records:
+        out.append(f'    [{record[0]}, {record[1]}, {record[2]}],\n')
+    out.append('];\n')
+    out.append(array('CASE_SEQUENCES', 'u32', sequences))
+    return ''.join(out)
+
+def is_uncased(ch):
+    c = chr(ch)
+    return c.lower() == c and c.upper() == c and c.title() == c
+
+def canonical_decomposition(ch):
+    decomposition = unicodedata.decomposition(chr(ch))
+    if not decomposition or decomposition.startswith('<'):
+        return None
+    return [int(part, 16) for part in decomposition.split()]
+
+def normalisation_tables():
+    # Full canonical decompositions. Hangul syllables are decomposed algorithmically
+    sequences = [0]
+    values = []
+    limit = max(ch for ch in range(0x110000) if canonical_decomposition(ch)) + 1
+    for ch in range(limit):
+        if HANGUL_START <= ch < HANGUL_END or not canonical_decomposition(ch):
+            values.append(0)
+            continue
+        decomposed = unicodedata.normalize('NFD', chr(ch))
+        values.append(len(sequences))
+        sequences.append(len(decomposed))
+        sequences.extend(ord(c) for c in decomposed)
+    assert len(sequences) < 1 << 16
+    out = [two_level('DECOMPOSITION', values, 'u16')]
+    out.append(array('DECOMPOSITION_SEQUENCES', 'u32', sequences))
+
+    limit = max(ch for ch in range(0x110000) if unicodedata.combining(chr(ch))) + 1
+    out.append(two_level('COMBINING_CLASS', [unicodedata.combining(chr(ch)) for ch in range(limit)], 'u8'))
+
+    # Primary composites: pairs which NFC composes back together
+    compositions = []
+    for ch in range(0x110000):
+        if HANGUL_START <= ch < HANGUL_END:
+            continue
+        parts = canonical_decomposition(ch)
+        if parts and len(parts) == 2 and unicodedata.normalize('NFC', chr(parts[0]) + chr(parts[1])) == chr(ch):
+            compositions.append((parts[0], parts[1], ch))
+    compositions.sort()
+    # The normalisation fast paths depend on these
+    assert min(second for _, second, _ in compositions) >= 0x300
+    assert all(unicodedata.normalize('NFC', chr(ch)) == chr(ch) for ch in range(0x300))
+    assert all(unicodedata.normalize('NFD', chr(ch)) == chr(ch) for ch in range(0xC0))
+    out.append(f'pub static COMPOSITIONS: [(u32, u32, u32); {len(compositions)}] = [\n')
+    for first, second, composite in compositions:
+        out.append(f'    (0x{first:X}, 0x{second:X}, 0x{composite:X}),\n')
+    out.append('];\n')
+    return ''.join(out)
+
+print(f'''/*
+
+Unicode tables
+==============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+Generated by remglk/scripts/unicode_tables.py from Unicode {unicodedata.unidata_version}. Do not edit!
+
+*/
+
+pub const SHIFT: u32 = {SHIFT};
+pub const MULTI: i32 = 0x{MULTI:X};
+''')
+print(case_tables())
+print(normalisation_tables(), end='')
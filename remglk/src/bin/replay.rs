@@ -0,0 +1,278 @@
+/*
+
+Replay harness
+==============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+/*
+
+Replays recorded GlkOte event logs against the library as fast as possible, and reports its throughput.
+
+A log has one JSON object per line: GlkOte events, each optionally followed by an `{"output": "..."}` record of the text the game printed in response (see benches/fixtures/transcript.jsonl). Each event is parsed and given to a `Session`, the recorded output is printed into a buffer window below a one line status window, and the resulting state update is sent through the session's transport to a sink which only counts bytes. A turn is timed from reading its event to finishing its update.
+
+*/
+
+use std::env;
+use std::fs;
+use std::io::{self, Write};
+use std::process;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::Arc;
+use std::thread;
+use std::time::{Duration, Instant};
+
+use remglk::glkapi::constants::*;
+use remglk::glkapi::deserialise::Deserialiser;
+use remglk::glkapi::host::Session;
+use remglk::glkapi::json::{self, JsonReader};
+use remglk::glkapi::protocol::*;
+use remglk::glkapi::windows::buffer::BufferWindowText;
+use remglk::glkapi::windows::grid::GridWindow;
+
+const BUFFER_WINDOW: u32 = 1;
+const STATUS_WINDOW: u32 = 2;
+const PAIR_WINDOW: u32 = 3;
+
+const USAGE: &str = "Usage: replay [--repeat N] [--threads N] LOG...
+
+Replay GlkOte event logs, reporting turns per second, update bytes per turn, per-turn latency and peak memory use.
+
+  --repeat N    Replay each log N times per thread (default 100)
+  --threads N   Replay on N threads at once, each with its own sessions (default 1)";
+
+struct Turn {
+    event: String,
+    /** The type of input to ask for next */
+    input: TextInputType,
+    output: String,
+}
+
+struct Options {
+    logs: Vec<String>,
+    repeat: usize,
+    threads: usize,
+}
+
+/** Output which is only counted */
+struct CountingSink(Arc<AtomicUsize>);
+
+impl Write for CountingSink {
+    fn write(&mut self, buf: &[u8]) -> io::Result<usize> {
+        self.0.fetch_add(buf.len(), Ordering::Relaxed);
+        Ok(buf.len())
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        Ok(())
+    }
+}
+
+/** Per-turn measurements */
+#[derive(Default)]
+struct Results {
+    bytes: usize,
+    latencies: Vec<Duration>,
+}
+
+fn fail(message: &str) -> ! {
+    eprintln!("replay: {}", message);
+    process::exit(1);
+}
+
+fn parse_options() -> Options {
+    let mut options = Options {
+        logs: Vec::new(),
+        repeat: 100,
+        threads: 1,
+    };
+    let mut args = env::args().skip(1);
+    while let Some(arg) = args.next() {
+        let mut number = |name: &str| -> usize {
+            match args.next().and_then(|val| val.parse().ok()) {
+                Some(val) if val > 0 => val,
+                _ => fail(&format!("{} needs a positive number", name)),
+            }
+        };
+        match arg.as_str() {
+            "--help" | "-h" => {
+                println!("{}", USAGE);
+                process::exit(0);
+            },
+            "--repeat" => options.repeat = number("--repeat"),
+            "--threads" => options.threads = number("--threads"),
+            _ if arg.starts_with('-') => fail(&format!("unknown option {}\n\n{}", arg, USAGE)),
+            _ => options.logs.push(arg),
+        }
+    }
+    if options.logs.is_empty() {
+        fail(USAGE);
+    }
+    options
+}
+
+/** Split a log into turns, checking that every event can be parsed */
+fn load_log(path: &str) -> Vec<Turn> {
+    let data = fs::read_to_string(path).unwrap_or_else(|err| fail(&format!("{}: {}", path, err)));
+    let mut turns: Vec<Turn> = Vec::new();
+    for (i, line) in data.lines().enumerate() {
+        let line = line.trim();
+        if line.is_empty() {
+            continue;
+        }
+        let bad_line = |err: &dyn std::fmt::Display| -> ! {fail(&format!("{}:{}: {}", path, i + 1, err))};
+        if line.starts_with("{\"output\"") {
+            let turn = turns.last_mut().unwrap_or_else(|| bad_line(&"output before any event"));
+            let mut reader = JsonReader::new(line);
+            let output = reader.begin_object()
+                .and_then(|_| reader.next_key())
+                .and_then(|_| reader.str())
+                .unwrap_or_else(|err| bad_line(&err));
+            turn.output.push_str(&output);
+            continue;
+        }
+        let input = match json::parse_event(line) {
+            Ok(Event::CharEvent(_)) => TextInputType::Char,
+            Ok(_) => TextInputType::Line,
+            Err(err) => bad_line(&err),
+        };
+        // The input asked for at the end of a turn is whatever the next event answers
+        if let Some(turn) = turns.last_mut() {
+            turn.input = input;
+        }
+        turns.push(Turn {
+            event: line.to_owned(),
+            input: TextInputType::Line,
+            output: String::new(),
+        });
+    }
+    if turns.is_empty() {
+        fail(&format!("{}: no events", path));
+    }
+    turns
+}
+
+/** Replay a log once in a new session */
+fn replay(turns: &[Turn], results: &mut Results) {
+    let bytes = Arc::new(AtomicUsize::new(0));
+    let mut session = Session::new(0, Box::new(CountingSink(bytes.clone())));
+    session.layout.open_root(BUFFER_WINDOW, wintype_TextBuffer);
+    session.layout.split(BUFFER_WINDOW, STATUS_WINDOW, PAIR_WINDOW, wintype_TextGrid, winmethod_Above | winmethod_Fixed, 1);
+    let mut buffer = BufferWindowText::new();
+    let mut status = GridWindow::new(0, 0);
+    for (gen, turn) in turns.iter().enumerate() {
+        let gen = gen as u32 + 1;
+        let start = Instant::now();
+        let before = bytes.load(Ordering::Relaxed);
+
+        let event = json::parse_event(&turn.event).unwrap();
+        session.receive(&event);
+
+        let mut windows = None;
+        if !session.layout.update().is_empty() {
+            let mut updates = session.arena.windows();
+            updates.extend([(BUFFER_WINDOW, 0), (STATUS_WINDOW, 1)].iter().filter_map(|&(id, rock)| session.layout.window_update(id, rock)));
+            if let Some(grid) = updates.iter().find(|update| update.id == STATUS_WINDOW) {
+                status.resize(grid.gridwidth.unwrap_or(0) as usize, grid.gridheight.unwrap_or(0) as usize);
+            }
+            windows = Some(updates);
+        }
+        status.move_cursor(0, 0);
+        status.set_style(Style::Subheader);
+        status.put_str(&format!(" Turn {}", gen));
+
+        buffer.put_str(&turn.output);
+        let arena = &mut session.arena;
+        let mut content = arena.content();
+        content.extend(buffer.take_update(BUFFER_WINDOW, arena).map(ContentUpdate::BufferWindowContentUpdate));
+        content.extend(status.take_update(STATUS_WINDOW, arena).map(ContentUpdate::GridWindowContentUpdate));
+        let mut inputs = arena.inputs();
+        inputs.push(InputUpdate {
+            gen: Some(gen),
+            hyperlink: None,
+            id: BUFFER_WINDOW,
+            initial: None,
+            maxlen: if turn.input == TextInputType::Line {Some(255)} else {None},
+            mouse: None,
+            terminators: None,
+            type_: Some(turn.input),
+            xpos: None,
+            ypos: None,
+        });
+
+        let update: Update<String> = Update::StateUpdate(StateUpdate {
+            autorestore: None,
+            content: if content.is_empty() {None} else {Some(content)},
+            debugoutput: None,
+            disable: None,
+            gen,
+            input: Some(inputs),
+            page_margin_bg: None,
+            specialinput: None,
+            timer: None,
+            windows,
+        });
+        session.send(update).unwrap();
+
+        results.latencies.push(start.elapsed());
+        results.bytes += bytes.load(Ordering::Relaxed) - before;
+    }
+}
+
+/** The process's peak resident set size, in kB. Only available on Linux */
+fn peak_rss() -> Option<u64> {
+    let status = fs::read_to_string("/proc/self/status").ok()?;
+    let line = status.lines().find(|line| line.starts_with("VmHWM:"))?;
+    line.split_whitespace().nth(1)?.parse().ok()
+}
+
+fn percentile(sorted: &[Duration], fraction: f64) -> Duration {
+    let index = ((sorted.len() as f64 * fraction).ceil() as usize).clamp(1, sorted.len()) - 1;
+    sorted[index]
+}
+
+fn main() {
+    let options = parse_options();
+    let logs: Arc<Vec<Vec<Turn>>> = Arc::new(options.logs.iter().map(|path| load_log(path)).collect());
+
+    let start = Instant::now();
+    let workers: Vec<_> = (0..options.threads).map(|_| {
+        let logs = logs.clone();
+        let repeat = options.repeat;
+        thread::spawn(move || {
+            let mut results = Results::default();
+            for _ in 0..repeat {
+                for turns in logs.iter() {
+                    replay(turns, &mut results);
+                }
+            }
+            results
+        })
+    }).collect();
+    let mut results = Results::default();
+    for worker in workers {
+        let worker_results = worker.join().unwrap_or_else(|_| fail("a replay thread panicked"));
+        results.bytes += worker_results.bytes;
+        results.latencies.extend(worker_results.latencies);
+    }
+    let elapsed = start.elapsed();
+
+    let turns = results.latencies.len();
+    results.latencies.sort_unstable();
+    let sessions = logs.len() * options.repeat * options.threads;
+    println!("sessions:        {}", sessions);
+    println!("turns:           {}", turns);
+    println!("elapsed:         {:.3} s", elapsed.as_secs_f64());
+    println!("turns/sec:       {:.0}", turns as f64 / elapsed.as_secs_f64());
+    println!("bytes/turn:      {:.1}", results.bytes as f64 / turns as f64);
+    println!("latency p50:     {:.2} µs", percentile(&results.latencies, 0.5).as_secs_f64() * 1e6);
+    println!("latency p99:     {:.2} µs", percentile(&results.latencies, 0.99).as_secs_f64() * 1e6);
+    match peak_rss() {
+        Some(kb) => println!("peak RSS:        {} kB", kb),
+        None => println!("peak RSS:        unknown"),
+    }
+}
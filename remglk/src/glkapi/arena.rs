@@ -0,0 +1,162 @@
+/*
+
+Update arenas
+=============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use super::protocol::*;
+
+/** How many free buffers of each kind to keep */
+const MAX_FREE_BUFFERS: usize = 64;
+const MAX_FREE_STRINGS: usize = 256;
+/** Buffers and strings bigger than these aren't kept, so that a session's arena holds at most about 4MB (64 × 6 × 8KB of buffers, and 256 × 4KB of strings) */
+const MAX_BUFFER_BYTES: usize = 8192;
+const MAX_STRING_CAPACITY: usize = 4096;
+
+/** Recycles the storage of state updates from one turn to the next
+ *
+ * Updates are built from the arena's buffers, and once written are taken apart by `reclaim`, which keeps every `Vec` and `String` (emptied, but with its capacity) to be handed out again. After the first few turns, building and dropping an update allocates and frees almost nothing.
+ *
+ * A true bump allocator would need arena lifetimes on every protocol type, or the unstable allocator API, so recycling whole buffers is the stable equivalent.
+ */
+#[derive(Default)]
+pub struct UpdateArena {
+    content: Vec<Vec<ContentUpdate>>,
+    grid_lines: Vec<Vec<GridWindowLine>>,
+    inputs: Vec<Vec<InputUpdate>>,
+    lines: Vec<Vec<LineData>>,
+    paragraphs: Vec<Vec<BufferWindowParagraphUpdate>>,
+    strings: Vec<String>,
+    windows: Vec<Vec<WindowUpdate>>,
+}
+
+fn keep<T>(free: &mut Vec<Vec<T>>, buf: Vec<T>) {
+    debug_assert!(buf.is_empty());
+    if free.len() < MAX_FREE_BUFFERS && buf.capacity() > 0 && buf.capacity() * std::mem::size_of::<T>() <= MAX_BUFFER_BYTES {
+        free.push(buf);
+    }
+}
+
+impl UpdateArena {
+    pub fn new() -> Self {
+        UpdateArena::default()
+    }
+
+    pub fn content(&mut self) -> Vec<ContentUpdate> {
+        self.content.pop().unwrap_or_default()
+    }
+
+    pub fn grid_lines(&mut self) -> Vec<GridWindowLine> {
+        self.grid_lines.pop().unwrap_or_default()
+    }
+
+    pub fn inputs(&mut self) -> Vec<InputUpdate> {
+        self.inputs.pop().unwrap_or_default()
+    }
+
+    pub fn lines(&mut self) -> Vec<LineData> {
+        self.lines.pop().unwrap_or_default()
+    }
+
+    pub fn paragraphs(&mut self) -> Vec<BufferWindowParagraphUpdate> {
+        self.paragraphs.pop().unwrap_or_default()
+    }
+
+    /** An empty string */
+    pub fn string(&mut self) -> String {
+        self.strings.pop().unwrap_or_default()
+    }
+
+    /** A copy of a string */
+    pub fn string_from(&mut self, str: &str) -> String {
+        let mut string = self.string();
+        string.push_str(str);
+        string
+    }
+
+    pub fn windows(&mut self) -> Vec<WindowUpdate> {
+        self.windows.pop().unwrap_or_default()
+    }
+
+    /** Take apart an update which has been written, keeping its storage */
+    pub fn reclaim<A>(&mut self, update: Update<A>) {
+        let state = match update {
+            Update::StateUpdate(state) => state,
+            Update::ErrorUpdate(error) => return self.reclaim_string(error.message),
+            _ => return,
+        };
+        if let Some(mut content) = state.content {
+            for update in content.drain(..) {
+                self.reclaim_content(update);
+            }
+            keep(&mut self.content, content);
+        }
+        if let Some(debugoutput) = state.debugoutput {
+            debugoutput.into_iter().for_each(|string| self.reclaim_string(string));
+        }
+        if let Some(mut inputs) = state.input {
+            for input in inputs.drain(..) {
+                if let Some(initial) = input.initial {
+                    self.reclaim_string(initial);
+                }
+            }
+            keep(&mut self.inputs, inputs);
+        }
+        if let Some(mut windows) = state.windows {
+            windows.clear();
+            keep(&mut self.windows, windows);
+        }
+    }
+
+    /** Return an unused list of grid lines */
+    pub fn reclaim_grid_lines(&mut self, lines: Vec<GridWindowLine>) {
+        keep(&mut self.grid_lines, lines);
+    }
+
+    fn reclaim_content(&mut self, update: ContentUpdate) {
+        match update {
+            ContentUpdate::BufferWindowContentUpdate(update) => {
+                if let Some(mut paragraphs) = update.text {
+                    for paragraph in paragraphs.drain(..) {
+                        if let Some(lines) = paragraph.content {
+                            self.reclaim_lines(lines);
+                        }
+                    }
+                    keep(&mut self.paragraphs, paragraphs);
+                }
+            },
+            ContentUpdate::GraphicsWindowContentUpdate(_) => {},
+            ContentUpdate::GridWindowContentUpdate(mut update) => {
+                for line in update.lines.drain(..) {
+                    if let Some(lines) = line.content {
+                        self.reclaim_lines(lines);
+                    }
+                }
+                self.reclaim_grid_lines(update.lines);
+            },
+        }
+    }
+
+    fn reclaim_lines(&mut self, mut lines: Vec<LineData>) {
+        for line in lines.drain(..) {
+            match line {
+                LineData::StylePair(_, text) => self.reclaim_string(text),
+                LineData::TextRun(run) => self.reclaim_string(run.text),
+                LineData::BufferWindowImage(_) => {},
+            }
+        }
+        keep(&mut self.lines, lines);
+    }
+
+    fn reclaim_string(&mut self, mut string: String) {
+        if self.strings.len() < MAX_FREE_STRINGS && string.capacity() > 0 && string.capacity() <= MAX_STRING_CAPACITY {
+            string.clear();
+            self.strings.push(string);
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*
+
+Interned strings
+================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::collections::HashMap;
+use std::fmt;
+use std::sync::{OnceLock, RwLock};
+
+/** An interned string, used for CSS property names and style selectors
+ *
+ * Almost all of these come from a small fixed set, which are given fixed indexes. Anything else is interned into a global table for the life of the process.
+ */
+#[derive(Clone, Copy, Eq, Hash, PartialEq)]
+pub struct Atom(u32);
+
+/** The predefined atoms */
+static PREDEFINED: &[&str] = &[
+    "",
+    "background-color",
+    "color",
+    "font-family",
+    "font-size",
+    "font-style",
+    "font-variant",
+    "font-weight",
+    "line-height",
+    "margin-left",
+    "margin-right",
+    "monospace",
+    "reverse",
+    "text-align",
+    "text-decoration",
+    "text-indent",
+    "div.Style_normal",
+    "div.Style_emphasized",
+    "div.Style_preformatted",
+    "div.Style_header",
+    "div.Style_subheader",
+    "div.Style_alert",
+    "div.Style_note",
+    "div.Style_blockquote",
+    "div.Style_input",
+    "div.Style_user1",
+    "div.Style_user2",
+    "span.Style_normal",
+    "span.Style_emphasized",
+    "span.Style_preformatted",
+    "span.Style_header",
+    "span.Style_subheader",
+    "span.Style_alert",
+    "span.Style_note",
+    "span.Style_blockquote",
+    "span.Style_input",
+    "span.Style_user1",
+    "span.Style_user2",
+];
+
+/** Limits on what `try_new` will intern, so that untrusted input can only leak about 512KB */
+const MAX_ATOMS: usize = 4096;
+const MAX_ATOM_LENGTH: usize = 128;
+
+#[derive(Default)]
+struct Interner {
+    ids: HashMap<&'static str, u32>,
+    strings: Vec<&'static str>,
+}
+
+fn interner() -> &'static RwLock<Interner> {
+    static INTERNER: OnceLock<RwLock<Interner>> = OnceLock::new();
+    INTERNER.get_or_init(|| {
+        let mut interner = Interner::default();
+        for &str in PREDEFINED {
+            interner.ids.insert(str, interner.strings.len() as u32);
+            interner.strings.push(str);
+        }
+        RwLock::new(interner)
+    })
+}
+
+impl Atom {
+    pub const WINDOW: Atom = Atom(0);
+    pub const BACKGROUND_COLOR: Atom = Atom(1);
+    pub const COLOR: Atom = Atom(2);
+
+    /** Intern a string. Strings which aren't predefined are kept for the life of the process, so this shouldn't be given untrusted input */
+    pub fn new(str: &str) -> Atom {
+        Atom::intern(str, false).unwrap()
+    }
+
+    /** Intern a string from untrusted input, unless it is too long or too many strings have been interned already */
+    pub fn try_new(str: &str) -> Option<Atom> {
+        Atom::intern(str, true)
+    }
+
+    fn intern(str: &str, limited: bool) -> Option<Atom> {
+        if let Some(&id) = interner().read().unwrap().ids.get(str) {
+            return Some(Atom(id));
+        }
+        let mut interner = interner().write().unwrap();
+        // Check again, someone may have got in before us
+        if let Some(&id) = interner.ids.get(str) {
+            return Some(Atom(id));
+        }
+        if limited && (str.len() > MAX_ATOM_LENGTH || interner.strings.len() >= MAX_ATOMS) {
+            return None;
+        }
+        let str: &'static str = Box::leak(str.into());
+        let id = interner.strings.len() as u32;
+        interner.ids.insert(str, id);
+        interner.strings.push(str);
+        Some(Atom(id))
+    }
+
+    pub fn as_str(&self) -> &'static str {
+        match PREDEFINED.get(self.0 as usize) {
+            Some(str) => str,
+            None => interner().read().unwrap().strings[self.0 as usize],
+        }
+    }
+}
+
+impl fmt::Debug for Atom {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        write!(f, "Atom({:?})", self.as_str())
+    }
+}
+
+impl From<&str> for Atom {
+    fn from(str: &str) -> Self {
+        Atom::new(str)
+    }
+}
@@ -0,0 +1,408 @@
+/*
+
+Blorb resources
+===============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::collections::HashMap;
+use std::fs::File;
+use std::io::{self, Read};
+use std::path::{Path, PathBuf};
+use std::sync::{Arc, Mutex, Weak};
+
+use super::*;
+use constants::*;
+use file_streams::{decode_chars, FileEncoding};
+use mmap::MappedFile;
+use protocol::ImageOperation;
+use streams::Stream;
+
+const GLK_NULL: u32 = 0;
+
+const fn fourcc(id: &[u8; 4]) -> u32 {
+    u32::from_be_bytes(*id)
+}
+
+const ID_FORM: u32 = fourcc(b"FORM");
+const ID_IFRS: u32 = fourcc(b"IFRS");
+const ID_JPEG: u32 = fourcc(b"JPEG");
+const ID_PNG: u32 = fourcc(b"PNG ");
+const ID_RIDX: u32 = fourcc(b"RIdx");
+const ID_TEXT: u32 = fourcc(b"TEXT");
+
+/** Resource usages */
+pub const USAGE_DATA: u32 = fourcc(b"Data");
+pub const USAGE_EXEC: u32 = fourcc(b"Exec");
+pub const USAGE_PICT: u32 = fourcc(b"Pict");
+pub const USAGE_SOUND: u32 = fourcc(b"Snd ");
+
+/** A chunk of a Blorb file */
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub struct Chunk {
+    /** The chunk type */
+    pub id: u32,
+    /** Where the chunk's data starts, or for FORM chunks, the chunk itself */
+    offset: usize,
+    len: usize,
+}
+
+impl Chunk {
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+}
+
+/** An image's natural size */
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub struct ImageInfo {
+    pub height: u32,
+    pub width: u32,
+}
+
+enum BlorbData {
+    Mapped(MappedFile),
+    Read(Vec<u8>),
+}
+
+/** A parsed Blorb file
+ *
+ * The chunk table is read once when the file is opened, and the file itself is mapped (or read, where mapping isn't supported), so that resources are slices of it.
+ *
+ * The size of each picture is also read from its PNG or JPEG header when the file is opened, so that drawing images or getting their info doesn't touch the image data.
+ */
+pub struct Blorb {
+    data: BlorbData,
+    images: HashMap<u32, ImageInfo>,
+    resources: HashMap<(u32, u32), Chunk>,
+}
+
+impl Blorb {
+    pub fn open(path: &Path) -> io::Result<Blorb> {
+        let mut file = File::open(path)?;
+        let data = match MappedFile::map(&file, false) {
+            Ok(mapping) => BlorbData::Mapped(mapping),
+            Err(err) if err.kind() == io::ErrorKind::Unsupported => {
+                let mut data = Vec::new();
+                file.read_to_end(&mut data)?;
+                BlorbData::Read(data)
+            },
+            Err(err) => return Err(err),
+        };
+        Blorb::new(data)
+    }
+
+    pub fn from_bytes(data: Vec<u8>) -> io::Result<Blorb> {
+        Blorb::new(BlorbData::Read(data))
+    }
+
+    fn new(data: BlorbData) -> io::Result<Blorb> {
+        let mut blorb = Blorb {
+            data,
+            images: HashMap::new(),
+            resources: HashMap::new(),
+        };
+        blorb.resources = parse_index(blorb.as_slice())?;
+        blorb.images = blorb.resources(USAGE_PICT)
+            .filter_map(|(number, chunk)| image_info(chunk.id, blorb.chunk_data(&chunk)).map(|info| (number, info)))
+            .collect();
+        Ok(blorb)
+    }
+
+    pub fn as_slice(&self) -> &[u8] {
+        match &self.data {
+            BlorbData::Mapped(mapping) => mapping.as_slice(),
+            BlorbData::Read(data) => data,
+        }
+    }
+
+    pub fn chunk_data(&self, chunk: &Chunk) -> &[u8] {
+        &self.as_slice()[chunk.offset..chunk.offset + chunk.len]
+    }
+
+    /** The size of a picture, for `glk_image_get_info`. None if there's no such picture, or its format isn't known */
+    pub fn image_info(&self, number: u32) -> Option<ImageInfo> {
+        self.images.get(&number).copied()
+    }
+
+    /** A graphics window operation to draw a picture, at its natural size unless another is given */
+    pub fn image_operation(&self, number: u32, x: u32, y: u32, size: Option<(u32, u32)>) -> Option<ImageOperation> {
+        let info = self.image_info(number)?;
+        let (width, height) = size.unwrap_or((info.width, info.height));
+        Some(ImageOperation {
+            height,
+            image: Some(number),
+            width,
+            url: None,
+            x,
+            y,
+        })
+    }
+
+    pub fn resource(&self, usage: u32, number: u32) -> Option<Chunk> {
+        self.resources.get(&(usage, number)).copied()
+    }
+
+    /** All resources of one usage, in no particular order */
+    pub fn resources(&self, usage: u32) -> impl Iterator<Item = (u32, Chunk)> + '_ {
+        self.resources.iter().filter(move |((chunk_usage, _), _)| *chunk_usage == usage).map(|(&(_, number), &chunk)| (number, chunk))
+    }
+}
+
+/** Read the resource index, checking that each resource is within the file */
+fn parse_index(data: &[u8]) -> io::Result<HashMap<(u32, u32), Chunk>> {
+    let u32_at = |offset: usize| -> io::Result<u32> {
+        data.get(offset..offset + 4)
+            .map(|bytes| u32::from_be_bytes(bytes.try_into().unwrap()))
+            .ok_or_else(|| invalid("Blorb chunk is truncated"))
+    };
+    if u32_at(0)? != ID_FORM || u32_at(8)? != ID_IFRS {
+        return Err(invalid("Not a Blorb file"));
+    }
+    let form_end = (u32_at(4)? as usize + 8).min(data.len());
+    // The index must be the first chunk
+    if u32_at(12)? != ID_RIDX {
+        return Err(invalid("Blorb file has no resource index"));
+    }
+    let count = u32_at(20)? as usize;
+    if u32_at(16)? as usize != count * 12 + 4 {
+        return Err(invalid("Blorb resource index has the wrong length"));
+    }
+    let mut resources = HashMap::with_capacity(count);
+    for entry in 0..count {
+        let entry = 24 + entry * 12;
+        let usage = u32_at(entry)?;
+        let number = u32_at(entry + 4)?;
+        let start = u32_at(entry + 8)? as usize;
+        let id = u32_at(start)?;
+        let len = u32_at(start + 4)? as usize;
+        let chunk = if id == ID_FORM {
+            Chunk {id, offset: start, len: len + 8}
+        }
+        else {
+            Chunk {id, offset: start + 8, len}
+        };
+        if chunk.offset + chunk.len > form_end {
+            return Err(invalid("Blorb resource is truncated"));
+        }
+        resources.insert((usage, number), chunk);
+    }
+    Ok(resources)
+}
+
+/** Read an image's size from its header */
+fn image_info(id: u32, data: &[u8]) -> Option<ImageInfo> {
+    match id {
+        ID_JPEG => jpeg_info(data),
+        ID_PNG => png_info(data),
+        _ => None,
+    }
+}
+
+/** The size is in the IHDR chunk, which must come first */
+fn png_info(data: &[u8]) -> Option<ImageInfo> {
+    if data.get(..8)? != b"\x89PNG\r\n\x1a\n" || data.get(12..16)? != b"IHDR" {
+        return None;
+    }
+    let u32_at = |offset: usize| data.get(offset..offset + 4).map(|bytes| u32::from_be_bytes(bytes.try_into().unwrap()));
+    Some(ImageInfo {
+        height: u32_at(20)?,
+        width: u32_at(16)?,
+    })
+}
+
+/** The size is in the start of frame segment, so skip through the segments before it */
+fn jpeg_info(data: &[u8]) -> Option<ImageInfo> {
+    if data.get(..2)? != [0xFF, 0xD8] {
+        return None;
+    }
+    let u16_at = |offset: usize| data.get(offset..offset + 2).map(|bytes| u16::from_be_bytes(bytes.try_into().unwrap()) as usize);
+    let mut pos = 2;
+    loop {
+        if *data.get(pos)? != 0xFF {
+            return None;
+        }
+        let marker = *data.get(pos + 1)?;
+        match marker {
+            // Fill bytes
+            0xFF => pos += 1,
+            // Markers without segments
+            0x01 | 0xD0..=0xD7 => pos += 2,
+            // Start of frame, except for DHT, JPG and DAC which share the range
+            0xC0..=0xCF if marker != 0xC4 && marker != 0xC8 && marker != 0xCC => {
+                return Some(ImageInfo {
+                    height: u16_at(pos + 5)? as u32,
+                    width: u16_at(pos + 7)? as u32,
+                });
+            },
+            // Start of scan or end of image, without having found a frame
+            0xD9 | 0xDA => return None,
+            _ => pos += 2 + u16_at(pos + 2)?,
+        }
+    }
+}
+
+fn invalid(reason: &str) -> io::Error {
+    io::Error::new(io::ErrorKind::InvalidData, reason)
+}
+
+/** Blorb files shared between sessions
+ *
+ * Sessions running the same story get the same `Blorb`, so it's only parsed and mapped once. Files are dropped from the cache once no session is using them.
+ */
+#[derive(Default)]
+pub struct BlorbCache {
+    files: Mutex<HashMap<PathBuf, Weak<Blorb>>>,
+}
+
+impl BlorbCache {
+    pub fn new() -> Self {
+        BlorbCache::default()
+    }
+
+    pub fn open(&self, path: &Path) -> io::Result<Arc<Blorb>> {
+        let path = path.canonicalize()?;
+        let mut files = self.files.lock().unwrap();
+        if let Some(blorb) = files.get(&path).and_then(Weak::upgrade) {
+            return Ok(blorb);
+        }
+        let blorb = Arc::new(Blorb::open(&path)?);
+        files.retain(|_, blorb| blorb.strong_count() > 0);
+        files.insert(path, Arc::downgrade(&blorb));
+        Ok(blorb)
+    }
+
+    /** How many files are open */
+    pub fn len(&self) -> usize {
+        self.files.lock().unwrap().values().filter(|blorb| blorb.strong_count() > 0).count()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+/** A read only stream of a Blorb data resource, as made by `glk_stream_open_resource`
+ *
+ * The stream reads straight from the shared Blorb, so opening one doesn't copy the resource. TEXT resources are read as Latin-1, or UTF-8 for Unicode streams; BINA resources as bytes, or big-endian 32 bit characters for Unicode streams.
+ */
+pub struct ResourceStream {
+    blorb: Arc<Blorb>,
+    chunk: Chunk,
+    disprock: Option<u32>,
+    encoding: FileEncoding,
+    /** Position in bytes */
+    pos: usize,
+    read_count: usize,
+    rock: u32,
+}
+
+impl ResourceStream {
+    /** Open a data resource, returning None if there isn't one with that number */
+    pub fn open(blorb: &Arc<Blorb>, number: u32, uni: bool, rock: u32) -> Option<Self> {
+        let chunk = blorb.resource(USAGE_DATA, number)?;
+        Some(ResourceStream {
+            blorb: blorb.clone(),
+            chunk,
+            disprock: None,
+            encoding: FileEncoding::new(uni, chunk.id == ID_TEXT),
+            pos: 0,
+            read_count: 0,
+            rock,
+        })
+    }
+
+    fn data(&self) -> &[u8] {
+        self.blorb.chunk_data(&self.chunk)
+    }
+
+    fn read_chars(&mut self, buf: &mut GlkArray, max_length: usize, line: bool) -> usize {
+        let (chars, bytes, _) = decode_chars(self.encoding, &self.data()[self.pos..], buf, 0, max_length, line, true);
+        self.pos += bytes;
+        self.read_count += chars;
+        chars
+    }
+}
+
+impl Stream for ResourceStream {
+    fn close(&mut self) -> StreamResult {
+        StreamResult {
+            read_count: self.read_count as u32,
+            write_count: 0,
+        }
+    }
+
+    fn disprock(&self) -> Option<u32> {
+        self.disprock
+    }
+
+    fn get_buffer(&mut self, buf: &mut GlkArray) -> u32 {
+        let len = buf.len();
+        self.read_chars(buf, len, false) as u32
+    }
+
+    fn get_char(&mut self, uni: bool) -> i32 {
+        let mut ch = [0u32];
+        let mut buf = GlkArray::U32(&mut ch);
+        self.read_count += 1;
+        let (chars, bytes, _) = decode_chars(self.encoding, &self.data()[self.pos..], &mut buf, 0, 1, false, true);
+        if chars == 0 {
+            return -1;
+        }
+        self.pos += bytes;
+        let ch = ch[0];
+        (if !uni && ch > MAX_LATIN1 {QUESTION_MARK} else {ch}) as i32
+    }
+
+    fn get_line(&mut self, buf: &mut GlkArray) -> u32 {
+        if buf.is_empty() {
+            return 0;
+        }
+        let len = buf.len() - 1;
+        let read_length = self.read_chars(buf, len, true);
+        buf.set_u32(read_length, GLK_NULL);
+        read_length as u32
+    }
+
+    fn get_position(&self) -> u32 {
+        match self.encoding {
+            FileEncoding::UnicodeBE => (self.pos / 4) as u32,
+            _ => self.pos as u32,
+        }
+    }
+
+    fn put_buffer(&mut self, _buf: &GlkArray) {
+        panic!("Cannot write to read-only stream")
+    }
+
+    fn put_char(&mut self, _ch: u32) {
+        panic!("Cannot write to read-only stream")
+    }
+
+    fn put_string(&mut self, _str: &str, _style: Option<&str>) {
+        panic!("Cannot write to read-only stream")
+    }
+
+    fn rock(&self) -> u32 {
+        self.rock
+    }
+
+    fn set_position(&mut self, mode: SeekMode, pos: i32) {
+        let len = self.data().len() as i64;
+        let unit: i64 = if let FileEncoding::UnicodeBE = self.encoding {4} else {1};
+        let new_pos = match mode {
+            SeekMode::Current => self.pos as i64 + pos as i64 * unit,
+            SeekMode::End => len + pos as i64 * unit,
+            SeekMode::Start => pos as i64 * unit,
+        };
+        self.pos = new_pos.clamp(0, len) as usize;
+    }
+}
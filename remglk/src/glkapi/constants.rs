@@ -126,12 +126,24 @@ pub const filemode_Write: u32 = 0x01;
 pub const filemode_Read: u32 = 0x02;
 pub const filemode_ReadWrite: u32 = 0x03;
 pub const filemode_WriteAppend: u32 = 0x05;
+#[derive(Clone, Copy)]
 pub enum FileMode {
     Read = 0x02,
     ReadWrite = 0x03,
     Write = 0x01,
     WriteAppend = 0x05,
 }
+impl FileMode {
+    pub fn from_glk(fmode: u32) -> Option<Self> {
+        match fmode {
+            filemode_Read => Some(FileMode::Read),
+            filemode_ReadWrite => Some(FileMode::ReadWrite),
+            filemode_Write => Some(FileMode::Write),
+            filemode_WriteAppend => Some(FileMode::WriteAppend),
+            _ => None,
+        }
+    }
+}
 
 pub const seekmode_Start: u32 = 0;
 pub const seekmode_Current: u32 = 1;
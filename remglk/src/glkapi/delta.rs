@@ -0,0 +1,97 @@
+/*
+
+Update delta compression
+========================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::collections::HashMap;
+
+use super::protocol::*;
+
+/** Remembers what was last sent to GlkOte, so that unchanged parts of an update can be left out
+ *
+ * GlkOte keeps its current `windows`, `input` and `page_margin_bg` state if an update omits them, but that's only safe when the client has actually received our last update. Each event tells us the last generation it saw, and if that isn't the one we last sent, the next update is sent in full.
+ */
+#[derive(Default)]
+pub struct UpdateTracker {
+    gen: u32,
+    input: Option<Vec<InputUpdate>>,
+    in_sync: bool,
+    page_margin_bg: Option<String>,
+    /** Window layouts, without their styles */
+    windows: Option<Vec<WindowUpdate>>,
+    window_styles: HashMap<u32, WindowStyles>,
+}
+
+impl UpdateTracker {
+    pub fn new() -> Self {
+        UpdateTracker::default()
+    }
+
+    /** Remove anything from a full update which the client already has, and remember what it will now have */
+    pub fn compress<A>(&mut self, update: &mut StateUpdate<A>) {
+        let in_sync = self.in_sync;
+
+        if let Some(windows) = &mut update.windows {
+            let layout: Vec<WindowUpdate> = windows.iter().map(|win| WindowUpdate {
+                styles: None,
+                ..win.clone()
+            }).collect();
+            let styles_unchanged = windows.iter().all(|win| win.styles.is_none() || win.styles.as_ref() == self.window_styles.get(&win.id));
+            if in_sync && styles_unchanged && self.windows.as_ref() == Some(&layout) {
+                update.windows = None;
+            }
+            else {
+                for win in windows.iter_mut() {
+                    if let Some(styles) = win.styles.take() {
+                        if !in_sync || self.window_styles.get(&win.id) != Some(&styles) {
+                            self.window_styles.insert(win.id, styles.clone());
+                            win.styles = Some(styles);
+                        }
+                    }
+                }
+                // Forget the styles of closed windows
+                self.window_styles.retain(|id, _| layout.iter().any(|win| win.id == *id));
+                self.windows = Some(layout);
+            }
+        }
+
+        if update.input.is_some() {
+            if in_sync && update.input == self.input {
+                update.input = None;
+            }
+            else {
+                self.input = update.input.clone();
+            }
+        }
+
+        if update.page_margin_bg.is_some() {
+            if in_sync && update.page_margin_bg == self.page_margin_bg {
+                update.page_margin_bg = None;
+            }
+            else {
+                self.page_margin_bg = update.page_margin_bg.clone();
+            }
+        }
+
+        self.gen = update.gen;
+        self.in_sync = true;
+    }
+
+    /** Check the generation of an incoming event */
+    pub fn event_received(&mut self, gen: u32) {
+        if gen != self.gen {
+            self.in_sync = false;
+        }
+    }
+
+    /** Send the next update in full (ie, for a refresh event) */
+    pub fn reset(&mut self) {
+        self.in_sync = false;
+    }
+}
@@ -0,0 +1,365 @@
+/*
+
+Protocol deserialisation
+========================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::borrow::Cow;
+use std::collections::HashMap;
+use std::fmt;
+
+use super::protocol::*;
+
+/** An error from parsing an input event */
+#[derive(Debug)]
+pub struct DeserialiseError {
+    /** Byte offset into the input */
+    pub offset: usize,
+    pub reason: &'static str,
+}
+
+impl fmt::Display for DeserialiseError {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        write!(f, "{} at offset {}", self.reason, self.offset)
+    }
+}
+
+impl std::error::Error for DeserialiseError {}
+
+pub type Result<T> = std::result::Result<T, DeserialiseError>;
+
+/** How deeply arrays and objects may be nested. `skip` recurses for each level, so without a limit a client could overflow the stack */
+pub const MAX_DEPTH: usize = 128;
+
+#[derive(Clone, Copy, PartialEq)]
+pub enum ValueKind {Array, Bool, Null, Number, Object, String}
+
+/** A pull parser for an input format of the GlkOte protocol
+ *
+ * Strings are returned borrowed from the input whenever they don't need unescaping.
+ */
+pub trait Deserialiser<'a> {
+    fn begin_array(&mut self) -> Result<()>;
+    fn begin_object(&mut self) -> Result<()>;
+    fn bool(&mut self) -> Result<bool>;
+    fn error(&self, reason: &'static str) -> DeserialiseError;
+    fn f64(&mut self) -> Result<f64>;
+    /** Move to the next array element, returning false at the end of the array */
+    fn next_element(&mut self) -> Result<bool>;
+    /** Read the next object key, returning None at the end of the object */
+    fn next_key(&mut self) -> Result<Option<Cow<'a, str>>>;
+    fn null(&mut self) -> Result<()>;
+    fn peek(&mut self) -> Result<ValueKind>;
+    fn str(&mut self) -> Result<Cow<'a, str>>;
+    fn u32(&mut self) -> Result<u32>;
+
+    /** Skip over a value of any type */
+    fn skip(&mut self) -> Result<()> {
+        match self.peek()? {
+            ValueKind::Array => {
+                self.begin_array()?;
+                while self.next_element()? {
+                    self.skip()?;
+                }
+            },
+            ValueKind::Bool => {self.bool()?;},
+            ValueKind::Null => self.null()?,
+            ValueKind::Number => {self.f64()?;},
+            ValueKind::Object => {
+                self.begin_object()?;
+                while self.next_key()?.is_some() {
+                    self.skip()?;
+                }
+            },
+            ValueKind::String => {self.str()?;},
+        }
+        Ok(())
+    }
+}
+
+/** Read a value which may be null */
+fn nullable<'a, D: Deserialiser<'a>, T>(d: &mut D, read: impl FnOnce(&mut D) -> Result<T>) -> Result<Option<T>> {
+    if d.peek()? == ValueKind::Null {
+        d.null()?;
+        return Ok(None);
+    }
+    read(d).map(Some)
+}
+
+/** The fields of all event types. The event can't be constructed until we've seen its type, which may come last */
+#[derive(Default)]
+struct RawEvent<'a> {
+    gen: u32,
+    metrics: Option<Metrics>,
+    partial: Option<HashMap<u32, Cow<'a, str>>>,
+    support: Option<Vec<Cow<'a, str>>>,
+    terminator: Option<TerminatorCode>,
+    type_: Option<Cow<'a, str>>,
+    value: RawValue<'a>,
+    window: Option<u32>,
+    x: Option<u32>,
+    y: Option<u32>,
+}
+
+#[derive(Default)]
+enum RawValue<'a> {
+    FileRef(FileRef<'a>),
+    #[default]
+    None,
+    Number(u32),
+    String(Cow<'a, str>),
+}
+
+/** Read one input event */
+pub fn deserialise_event<'a, D: Deserialiser<'a>>(d: &mut D) -> Result<Event<'a>> {
+    let mut raw = RawEvent::default();
+    d.begin_object()?;
+    while let Some(key) = d.next_key()? {
+        match key.as_ref() {
+            "gen" => raw.gen = d.u32()?,
+            "metrics" => raw.metrics = Some(deserialise_metrics(d)?),
+            "partial" => raw.partial = nullable(d, deserialise_partial)?,
+            "support" => raw.support = nullable(d, |d| {
+                let mut support = Vec::new();
+                d.begin_array()?;
+                while d.next_element()? {
+                    support.push(d.str()?);
+                }
+                Ok(support)
+            })?,
+            "terminator" => raw.terminator = nullable(d, |d| {
+                let name = d.str()?;
+                TerminatorCode::from_name(&name).ok_or_else(|| d.error("Unknown terminator"))
+            })?,
+            "type" => raw.type_ = Some(d.str()?),
+            "value" => raw.value = match d.peek()? {
+                ValueKind::Number => RawValue::Number(d.u32()?),
+                ValueKind::Object => deserialise_fileref(d)?.map_or(RawValue::None, RawValue::FileRef),
+                ValueKind::String => RawValue::String(d.str()?),
+                // External events can have any value, which we don't support yet
+                _ => {
+                    d.skip()?;
+                    RawValue::None
+                },
+            },
+            "window" => raw.window = nullable(d, |d| d.u32())?,
+            "x" => raw.x = Some(d.u32()?),
+            "y" => raw.y = Some(d.u32()?),
+            _ => d.skip()?,
+        }
+    }
+
+    let base = EventBase {
+        gen: raw.gen,
+        partial: raw.partial,
+    };
+    let type_ = raw.type_.ok_or_else(|| d.error("Event has no type"))?;
+    let window = |d: &D| raw.window.ok_or_else(|| d.error("Event has no window"));
+    let value_str = |d: &D, value: RawValue<'a>| match value {
+        RawValue::String(val) => Ok(val),
+        _ => Err(d.error("Event value must be a string")),
+    };
+    Ok(match type_.as_ref() {
+        "arrange" => Event::ArrangeEvent(ArrangeEvent {
+            base,
+            metrics: raw.metrics.ok_or_else(|| d.error("Arrange event has no metrics"))?,
+        }),
+        "char" => {
+            let window = window(d)?;
+            let value = value_str(d, raw.value)?;
+            let mut chars = value.chars();
+            let value = match (chars.next(), chars.next()) {
+                (Some(ch), None) => CharEventData::NormalKey(ch),
+                _ => CharEventData::SpecialKeyCode(SpecialKeyCode::from_name(&value).ok_or_else(|| d.error("Unknown special key"))?),
+            };
+            Event::CharEvent(CharEvent {
+                base,
+                value,
+                window,
+            })
+        },
+        "debuginput" => Event::DebugEvent(DebugEvent {
+            base,
+            value: value_str(d, raw.value)?,
+        }),
+        "external" => Event::ExternalEvent(ExternalEvent {
+            base,
+        }),
+        "hyperlink" => Event::HyperlinkEvent(HyperlinkEvent {
+            base,
+            value: match raw.value {
+                RawValue::Number(val) => val,
+                _ => return Err(d.error("Hyperlink value must be a number")),
+            },
+            window: window(d)?,
+        }),
+        "init" => Event::InitEvent(InitEvent {
+            base,
+            metrics: raw.metrics.ok_or_else(|| d.error("Init event has no metrics"))?,
+            support: raw.support.unwrap_or_default(),
+        }),
+        "line" => Event::LineEvent(LineEvent {
+            base,
+            terminator: raw.terminator,
+            window: window(d)?,
+            value: value_str(d, raw.value)?,
+        }),
+        "mouse" => Event::MouseEvent(MouseEvent {
+            base,
+            window: window(d)?,
+            x: raw.x.ok_or_else(|| d.error("Mouse event has no x"))?,
+            y: raw.y.ok_or_else(|| d.error("Mouse event has no y"))?,
+        }),
+        "redraw" => Event::RedrawEvent(RedrawEvent {
+            base,
+            window: raw.window,
+        }),
+        "refresh" => Event::RefreshEvent(RefreshEvent {
+            base,
+        }),
+        "specialresponse" => Event::SpecialEvent(SpecialEvent {
+            base,
+            value: match raw.value {
+                RawValue::FileRef(fref) => Some(fref),
+                _ => None,
+            },
+        }),
+        "timer" => Event::TimerEvent(TimerEvent {
+            base,
+        }),
+        _ => return Err(d.error("Unknown event type")),
+    })
+}
+
+/** Read a file reference, returning None for objects which aren't file references */
+fn deserialise_fileref<'a, D: Deserialiser<'a>>(d: &mut D) -> Result<Option<FileRef<'a>>> {
+    let mut content = None;
+    let mut dirent = None;
+    let mut filename = None;
+    let mut gameid = None;
+    let mut usage = None;
+    d.begin_object()?;
+    while let Some(key) = d.next_key()? {
+        let field = match key.as_ref() {
+            "content" => &mut content,
+            "dirent" => &mut dirent,
+            "filename" => &mut filename,
+            "gameid" => &mut gameid,
+            "usage" => &mut usage,
+            _ => {
+                d.skip()?;
+                continue;
+            },
+        };
+        *field = nullable(d, |d| d.str())?;
+    }
+    Ok(filename.map(|filename| FileRef {
+        content,
+        dirent,
+        filename,
+        gameid,
+        usage,
+    }))
+}
+
+fn deserialise_metrics<'a, D: Deserialiser<'a>>(d: &mut D) -> Result<Metrics> {
+    let mut metrics = Metrics::default();
+    d.begin_object()?;
+    while let Some(key) = d.next_key()? {
+        let field = match key.as_ref() {
+            "buffercharheight" => &mut metrics.buffercharheight,
+            "buffercharwidth" => &mut metrics.buffercharwidth,
+            "buffermargin" => &mut metrics.buffermargin,
+            "buffermarginx" => &mut metrics.buffermarginx,
+            "buffermarginy" => &mut metrics.buffermarginy,
+            "charheight" => &mut metrics.charheight,
+            "charwidth" => &mut metrics.charwidth,
+            "graphicsmargin" => &mut metrics.graphicsmargin,
+            "graphicsmarginx" => &mut metrics.graphicsmarginx,
+            "graphicsmarginy" => &mut metrics.graphicsmarginy,
+            "gridcharheight" => &mut metrics.gridcharheight,
+            "gridcharwidth" => &mut metrics.gridcharwidth,
+            "gridmargin" => &mut metrics.gridmargin,
+            "gridmarginx" => &mut metrics.gridmarginx,
+            "gridmarginy" => &mut metrics.gridmarginy,
+            "height" => {
+                metrics.height = d.f64()?;
+                continue;
+            },
+            "inspacing" => &mut metrics.inspacing,
+            "inspacingx" => &mut metrics.inspacingx,
+            "inspacingy" => &mut metrics.inspacingy,
+            "margin" => &mut metrics.margin,
+            "marginx" => &mut metrics.marginx,
+            "marginy" => &mut metrics.marginy,
+            "outspacing" => &mut metrics.outspacing,
+            "outspacingx" => &mut metrics.outspacingx,
+            "outspacingy" => &mut metrics.outspacingy,
+            "spacing" => &mut metrics.spacing,
+            "spacingx" => &mut metrics.spacingx,
+            "spacingy" => &mut metrics.spacingy,
+            "width" => {
+                metrics.width = d.f64()?;
+                continue;
+            },
+            _ => {
+                d.skip()?;
+                continue;
+            },
+        };
+        *field = nullable(d, |d| d.f64())?;
+    }
+    Ok(metrics)
+}
+
+fn deserialise_partial<'a, D: Deserialiser<'a>>(d: &mut D) -> Result<HashMap<u32, Cow<'a, str>>> {
+    let mut partial = HashMap::new();
+    d.begin_object()?;
+    while let Some(key) = d.next_key()? {
+        let window = key.parse().map_err(|_| d.error("Partial input key must be a window ID"))?;
+        partial.insert(window, d.str()?);
+    }
+    Ok(partial)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use super::super::{json, msgpack};
+
+    fn too_deep(result: Result<Event>) -> bool {
+        matches!(result, Err(err) if err.reason == "Too deeply nested")
+    }
+
+    #[test]
+    fn nesting_limit() {
+        let nested = |depth: usize| format!(r#"{{"type":"timer","gen":1,"junk":{}1{}}}"#, "[".repeat(depth), "]".repeat(depth));
+        // The event itself is one level
+        assert!(json::parse_event(&nested(MAX_DEPTH - 1)).is_ok());
+        assert!(too_deep(json::parse_event(&nested(MAX_DEPTH))));
+        assert!(too_deep(json::parse_event(&nested(500_000))));
+        let nested = format!(r#"{{"type":"timer","gen":1,"junk":{}"#, r#"{"a":"#.repeat(500_000));
+        assert!(too_deep(json::parse_event(&nested)));
+
+        // {"type": "timer", "junk": [[[...1]]]}
+        let nested = |depth: usize| {
+            let mut data = vec![0x82, 0xA4];
+            data.extend_from_slice(b"type");
+            data.push(0xA5);
+            data.extend_from_slice(b"timer");
+            data.push(0xA4);
+            data.extend_from_slice(b"junk");
+            data.extend(std::iter::repeat_n(0x91, depth));
+            data.push(1);
+            data
+        };
+        assert!(msgpack::parse_event(&nested(MAX_DEPTH - 1)).is_ok());
+        assert!(too_deep(msgpack::parse_event(&nested(MAX_DEPTH))));
+        assert!(too_deep(msgpack::parse_event(&nested(500_000))));
+    }
+}
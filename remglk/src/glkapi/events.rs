@@ -0,0 +1,97 @@
+/*
+
+Event queue
+===========
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::collections::VecDeque;
+
+use super::protocol::*;
+
+/** Input events waiting for `glk_select`
+ *
+ * Arrange and redraw events describe state rather than actions, and timer events don't stack, so when a newer one arrives any older ones still waiting are dropped, saving the game from redrawing for each of them. The survivor keeps the highest gen of those it replaced.
+ */
+#[derive(Default)]
+pub struct EventQueue {
+    /** How many events have been dropped */
+    coalesced: usize,
+    events: VecDeque<Event<'static>>,
+}
+
+impl EventQueue {
+    pub fn new() -> Self {
+        EventQueue::default()
+    }
+
+    pub fn coalesced(&self) -> usize {
+        self.coalesced
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.events.is_empty()
+    }
+
+    pub fn len(&self) -> usize {
+        self.events.len()
+    }
+
+    pub fn pop(&mut self) -> Option<Event<'static>> {
+        self.events.pop_front()
+    }
+
+    /** Take the first event `pred` accepts */
+    pub fn pop_matching(&mut self, pred: impl Fn(&Event) -> bool) -> Option<Event<'static>> {
+        let index = self.events.iter().position(pred)?;
+        self.events.remove(index)
+    }
+
+    /** Queue an event, dropping any older ones it replaces
+     *
+     * The new event is always the one kept, and it has to outlive the message it was parsed from, so any strings it borrows (such as a line event's text) are copied. Events which already own their strings are moved without copying.
+     */
+    pub fn push(&mut self, event: Event) {
+        let mut event = event.into_owned();
+        let before = self.events.len();
+        let mut gen = event.base().gen;
+        match &mut event {
+            Event::ArrangeEvent(_) => self.events.retain(|queued| match queued {
+                Event::ArrangeEvent(queued) => {
+                    gen = gen.max(queued.base.gen);
+                    false
+                },
+                _ => true,
+            }),
+            Event::TimerEvent(_) => self.events.retain(|queued| match queued {
+                Event::TimerEvent(queued) => {
+                    gen = gen.max(queued.base.gen);
+                    false
+                },
+                _ => true,
+            }),
+            Event::RedrawEvent(redraw) => {
+                // A queued redraw of every window covers this one too
+                if self.events.iter().any(|queued| matches!(queued, Event::RedrawEvent(RedrawEvent {window: None, ..}))) {
+                    redraw.window = None;
+                }
+                let window = redraw.window;
+                self.events.retain(|queued| match queued {
+                    Event::RedrawEvent(queued) if window.is_none() || queued.window == window => {
+                        gen = gen.max(queued.base.gen);
+                        false
+                    },
+                    _ => true,
+                });
+            },
+            _ => {},
+        }
+        self.coalesced += before - self.events.len();
+        event.base_mut().gen = gen;
+        self.events.push_back(event);
+    }
+}
@@ -0,0 +1,607 @@
+/*
+
+Glk File Streams
+================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::cmp::min;
+use std::fs::{File, OpenOptions};
+use std::io::{self, Read, Seek, SeekFrom, Write};
+use std::path::{Path, PathBuf};
+
+use super::*;
+use constants::*;
+use mmap::MappedFile;
+use snapshot::*;
+use streams::{Stream, StreamState};
+
+const GLK_NULL: u32 = 0;
+const READ_CHUNK_SIZE: usize = 8192;
+const WRITE_BUFFER_SIZE: usize = 8192;
+const REPLACEMENT_CHARACTER: u32 = 0xFFFD;
+
+/** How characters are stored in a file */
+#[derive(Clone, Copy, PartialEq)]
+pub enum FileEncoding {
+    /** One byte per character */
+    Latin1,
+    /** Four byte big-endian characters (Unicode binary files) */
+    UnicodeBE,
+    /** UTF-8 (Unicode text files) */
+    UTF8,
+}
+
+impl FileEncoding {
+    pub fn new(uni: bool, text: bool) -> Self {
+        match (uni, text) {
+            (false, _) => FileEncoding::Latin1,
+            (true, false) => FileEncoding::UnicodeBE,
+            (true, true) => FileEncoding::UTF8,
+        }
+    }
+}
+
+/** A Glk file reference */
+pub struct GlkFileRef {
+    pub disprock: Option<u32>,
+    pub path: PathBuf,
+    pub rock: u32,
+    /** The Glk fileusage bits */
+    pub usage: u32,
+}
+
+/** A file stream
+ *
+ * Read and ReadWrite files are memory mapped where possible, so that reads and seeks are served directly from the mapping. Write and WriteAppend files, and platforms without mmap, use normal file I/O.
+ *
+ * Writes are coalesced into a buffer, which is only written out when it fills, or on `flush`, `close`, `set_position`, or before a read.
+ */
+pub struct FileStream {
+    disprock: Option<u32>,
+    encoding: FileEncoding,
+    fmode: FileMode,
+    path: PathBuf,
+    /** Position in bytes */
+    pos: usize,
+    read_count: usize,
+    rock: u32,
+    storage: Storage,
+    write_buffer: Vec<u8>,
+    /** Byte position of the start of the write buffer */
+    write_buffer_start: usize,
+    write_count: usize,
+}
+
+impl FileStream {
+    pub fn open(path: &Path, fmode: FileMode, encoding: FileEncoding, rock: u32) -> io::Result<Self> {
+        let storage = Storage::open(path, fmode, true)?;
+        let pos = if let FileMode::WriteAppend = fmode {storage.len()} else {0};
+        Ok(FileStream {
+            disprock: None,
+            encoding,
+            fmode,
+            path: path.to_owned(),
+            pos,
+            read_count: 0,
+            rock,
+            storage,
+            write_buffer: Vec::new(),
+            write_buffer_start: pos,
+            write_count: 0,
+        })
+    }
+
+    /** Reopen a file stream saved by `snapshot`. Write mode files are not truncated again */
+    pub fn from_snapshot(r: &mut SectionReader) -> io::Result<Self> {
+        let state = StreamState::read(r)?;
+        let encoding = match r.u8()? {
+            0 => FileEncoding::Latin1,
+            1 => FileEncoding::UnicodeBE,
+            2 => FileEncoding::UTF8,
+            _ => return Err(io::Error::new(io::ErrorKind::InvalidData, "Unknown file encoding in snapshot")),
+        };
+        let path = PathBuf::from(r.str()?);
+        let storage = Storage::open(&path, state.fmode, false)?;
+        if state.pos > storage.len() {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "File stream snapshot position is past the end of the file"));
+        }
+        Ok(FileStream {
+            disprock: state.disprock,
+            encoding,
+            fmode: state.fmode,
+            path,
+            pos: state.pos,
+            read_count: state.read_count,
+            rock: state.rock,
+            storage,
+            write_buffer: Vec::new(),
+            write_buffer_start: state.pos,
+            write_count: state.write_count,
+        })
+    }
+
+    pub fn is_mapped(&self) -> bool {
+        matches!(self.storage, Storage::Mapped {..})
+    }
+
+    /** Save the stream's state, first writing out any buffered data so the file is up to date. Non UTF-8 paths can't be saved */
+    pub fn snapshot(&mut self, w: &mut SectionWriter) -> io::Result<()> {
+        self.flush_write_buffer();
+        let path = self.path.to_str().ok_or_else(|| io::Error::new(io::ErrorKind::InvalidData, "File stream path is not UTF-8"))?;
+        StreamState {
+            disprock: self.disprock,
+            fmode: self.fmode,
+            pos: self.pos,
+            read_count: self.read_count,
+            rock: self.rock,
+            write_count: self.write_count,
+        }.write(w);
+        w.u8(match self.encoding {
+            FileEncoding::Latin1 => 0,
+            FileEncoding::UnicodeBE => 1,
+            FileEncoding::UTF8 => 2,
+        });
+        w.str(path);
+        Ok(())
+    }
+
+    /** Read characters into `buf`, optionally stopping after a newline */
+    fn read_chars(&mut self, buf: &mut GlkArray, max_length: usize, line: bool) -> usize {
+        let mut i = 0;
+        while i < max_length {
+            let len = self.storage.len();
+            let chunk = io_result(self.storage.peek(self.pos));
+            if chunk.is_empty() {
+                break;
+            }
+            let at_end = self.pos + chunk.len() >= len;
+            let (chars, bytes, newline) = decode_chars(self.encoding, chunk, buf, i, max_length - i, line, at_end);
+            // Otherwise a character was cut off at the end of the chunk, and peeking again will return all of it
+            if chars == 0 && at_end {
+                // A truncated final character
+                break;
+            }
+            i += chars;
+            self.pos += bytes;
+            if newline {
+                break;
+            }
+        }
+        self.read_count += i;
+        i
+    }
+
+    /** Encode characters and write them at the current position */
+    fn write_chars(&mut self, chars: impl Iterator<Item = u32>) {
+        let mut scratch = [0u8; 1024];
+        let mut len = 0;
+        for ch in chars {
+            if len + 4 > scratch.len() {
+                self.write_bytes(&scratch[..len]);
+                len = 0;
+            }
+            len += encode_char(self.encoding, ch, &mut scratch[len..]);
+        }
+        self.write_bytes(&scratch[..len]);
+    }
+
+    fn write_bytes(&mut self, bytes: &[u8]) {
+        if bytes.is_empty() {
+            return;
+        }
+        let buffer_end = self.write_buffer_start + self.write_buffer.len();
+        if self.pos != buffer_end || self.write_buffer.len() + bytes.len() > WRITE_BUFFER_SIZE {
+            self.flush_write_buffer();
+        }
+        if self.write_buffer.is_empty() {
+            self.write_buffer_start = self.pos;
+        }
+        if bytes.len() >= WRITE_BUFFER_SIZE {
+            io_result(self.storage.write_at(self.pos, bytes));
+        }
+        else {
+            if self.write_buffer.capacity() == 0 {
+                self.write_buffer.reserve_exact(WRITE_BUFFER_SIZE);
+            }
+            self.write_buffer.extend_from_slice(bytes);
+        }
+        self.pos += bytes.len();
+    }
+
+    fn flush_write_buffer(&mut self) {
+        if !self.write_buffer.is_empty() {
+            io_result(self.storage.write_at(self.write_buffer_start, &self.write_buffer));
+            self.write_buffer.clear();
+        }
+    }
+
+    fn check_readable(&mut self) {
+        if let FileMode::Write | FileMode::WriteAppend = self.fmode {
+            panic!("Cannot read from write-only stream")
+        }
+        // Reads must see anything we've written
+        self.flush_write_buffer();
+    }
+
+    fn check_writable(&self) {
+        if let FileMode::Read = self.fmode {
+            panic!("Cannot write to read-only stream")
+        }
+    }
+}
+
+impl Stream for FileStream {
+    fn close(&mut self) -> StreamResult {
+        self.flush();
+        StreamResult {
+            read_count: self.read_count as u32,
+            write_count: self.write_count as u32,
+        }
+    }
+
+    fn disprock(&self) -> Option<u32> {
+        self.disprock
+    }
+
+    fn get_buffer(&mut self, buf: &mut GlkArray) -> u32 {
+        self.check_readable();
+        let len = buf.len();
+        self.read_chars(buf, len, false) as u32
+    }
+
+    fn get_char(&mut self, uni: bool) -> i32 {
+        self.check_readable();
+        self.read_count += 1;
+        let chunk = io_result(self.storage.peek(self.pos));
+        let (ch, len) = match self.encoding {
+            _ if chunk.is_empty() => return -1,
+            FileEncoding::Latin1 => (chunk[0] as u32, 1),
+            FileEncoding::UnicodeBE => {
+                if chunk.len() < 4 {
+                    return -1;
+                }
+                (u32::from_be_bytes(chunk[..4].try_into().unwrap()), 4)
+            },
+            FileEncoding::UTF8 => decode_utf8(chunk),
+        };
+        self.pos += len;
+        (if !uni && ch > MAX_LATIN1 {QUESTION_MARK} else {ch}) as i32
+    }
+
+    fn get_line(&mut self, buf: &mut GlkArray) -> u32 {
+        self.check_readable();
+        if buf.is_empty() {
+            return 0;
+        }
+        let len = buf.len() - 1;
+        let read_length = self.read_chars(buf, len, true);
+        buf.set_u32(read_length, GLK_NULL);
+        read_length as u32
+    }
+
+    fn get_position(&self) -> u32 {
+        match self.encoding {
+            FileEncoding::UnicodeBE => (self.pos / 4) as u32,
+            _ => self.pos as u32,
+        }
+    }
+
+    fn put_buffer(&mut self, buf: &GlkArray) {
+        self.check_writable();
+        match (self.encoding, buf) {
+            (FileEncoding::Latin1, GlkArray::U8(arr)) => self.write_bytes(arr),
+            _ => self.write_chars((0..buf.len()).map(|i| buf.get_u32(i))),
+        }
+        self.write_count += buf.len();
+    }
+
+    fn put_char(&mut self, ch: u32) {
+        self.check_writable();
+        let mut bytes = [0u8; 4];
+        let len = encode_char(self.encoding, ch, &mut bytes);
+        self.write_bytes(&bytes[..len]);
+        self.write_count += 1;
+    }
+
+    fn put_string(&mut self, str: &str, _style: Option<&str>) {
+        self.check_writable();
+        match self.encoding {
+            FileEncoding::UTF8 => self.write_bytes(str.as_bytes()),
+            FileEncoding::Latin1 if str.is_ascii() => self.write_bytes(str.as_bytes()),
+            _ => self.write_chars(str.chars().map(|ch| ch as u32)),
+        }
+        self.write_count += str.chars().count();
+    }
+
+    fn flush(&mut self) {
+        self.flush_write_buffer();
+        io_result(self.storage.flush());
+    }
+
+    fn rock(&self) -> u32 {
+        self.rock
+    }
+
+    fn set_position(&mut self, mode: SeekMode, pos: i32) {
+        self.flush_write_buffer();
+        let unit: i64 = if let FileEncoding::UnicodeBE = self.encoding {4} else {1};
+        let len = self.storage.len() as i64;
+        let new_pos = match mode {
+            SeekMode::Current => self.pos as i64 + pos as i64 * unit,
+            SeekMode::End => len + pos as i64 * unit,
+            SeekMode::Start => pos as i64 * unit,
+        };
+        self.pos = new_pos.clamp(0, len) as usize;
+    }
+}
+
+impl Drop for FileStream {
+    fn drop(&mut self) {
+        // Don't lose buffered output if the stream is dropped without being closed, but don't panic in a destructor either
+        if !self.write_buffer.is_empty() {
+            let _ = self.storage.write_at(self.write_buffer_start, &self.write_buffer);
+        }
+    }
+}
+
+/** Where the bytes of a file stream live */
+enum Storage {
+    Buffered(BufferedFile),
+    Mapped {
+        file: File,
+        /** The logical length of the file, which may be past the end of the mapping when it has been extended */
+        len: usize,
+        map: MappedFile,
+    },
+}
+
+impl Storage {
+    fn open(path: &Path, fmode: FileMode, truncate: bool) -> io::Result<Self> {
+        let mut options = OpenOptions::new();
+        match fmode {
+            FileMode::Read => options.read(true),
+            FileMode::ReadWrite => options.read(true).write(true).create(true),
+            FileMode::Write => options.write(true).create(true).truncate(truncate),
+            FileMode::WriteAppend => options.append(true).create(true),
+        };
+        let file = options.open(path)?;
+        match fmode {
+            FileMode::Read | FileMode::ReadWrite => Storage::new_mapped(file, matches!(fmode, FileMode::ReadWrite)),
+            FileMode::Write | FileMode::WriteAppend => Storage::new_buffered(file),
+        }
+    }
+
+    fn new_buffered(file: File) -> io::Result<Self> {
+        let len = file.metadata()?.len() as usize;
+        Ok(Storage::Buffered(BufferedFile {
+            file,
+            len,
+            window: Vec::new(),
+            window_start: 0,
+        }))
+    }
+
+    fn new_mapped(file: File, writable: bool) -> io::Result<Self> {
+        match MappedFile::map(&file, writable) {
+            Ok(map) => Ok(Storage::Mapped {
+                file,
+                len: map.len(),
+                map,
+            }),
+            Err(_) => Storage::new_buffered(file),
+        }
+    }
+
+    fn flush(&self) -> io::Result<()> {
+        match self {
+            Storage::Buffered(_) => Ok(()),
+            Storage::Mapped {map, ..} => map.flush(),
+        }
+    }
+
+    fn len(&self) -> usize {
+        match self {
+            Storage::Buffered(file) => file.len,
+            Storage::Mapped {len, ..} => *len,
+        }
+    }
+
+    /** Get the bytes available from a position. Returns at least four bytes unless the end of the file is near */
+    fn peek(&mut self, pos: usize) -> io::Result<&[u8]> {
+        match self {
+            Storage::Buffered(file) => file.peek(pos),
+            Storage::Mapped {file, len, map} => {
+                if *len > map.len() && pos + 4 > map.len() {
+                    // The file has been extended since it was mapped
+                    *map = MappedFile::map(file, map.writable())?;
+                }
+                let available = map.as_slice();
+                Ok(&available[min(pos, available.len())..])
+            },
+        }
+    }
+
+    fn write_at(&mut self, pos: usize, bytes: &[u8]) -> io::Result<()> {
+        match self {
+            Storage::Buffered(file) => file.write_at(pos, bytes),
+            Storage::Mapped {file, len, map} => {
+                let mapped = min(bytes.len(), map.len().saturating_sub(pos));
+                if mapped > 0 {
+                    map.as_mut_slice()[pos..pos + mapped].copy_from_slice(&bytes[..mapped]);
+                }
+                // Anything that extends the file goes straight to the file, and the mapping is refreshed when it's next read
+                if mapped < bytes.len() {
+                    file.seek(SeekFrom::Start((pos + mapped) as u64))?;
+                    file.write_all(&bytes[mapped..])?;
+                    *len = (*len).max(pos + bytes.len());
+                }
+                Ok(())
+            },
+        }
+    }
+}
+
+/** Normal file I/O with a read-ahead window */
+struct BufferedFile {
+    file: File,
+    len: usize,
+    window: Vec<u8>,
+    window_start: usize,
+}
+
+impl BufferedFile {
+    fn peek(&mut self, pos: usize) -> io::Result<&[u8]> {
+        let window_end = self.window_start + self.window.len();
+        let in_window = pos >= self.window_start && pos <= window_end;
+        if !in_window || (window_end - pos < 4 && window_end < self.len) {
+            self.window.resize(READ_CHUNK_SIZE, 0);
+            self.file.seek(SeekFrom::Start(pos as u64))?;
+            let mut filled = 0;
+            while filled < READ_CHUNK_SIZE {
+                match self.file.read(&mut self.window[filled..]) {
+                    Ok(0) => break,
+                    Ok(n) => filled += n,
+                    Err(err) if err.kind() == io::ErrorKind::Interrupted => {},
+                    Err(err) => return Err(err),
+                }
+            }
+            self.window.truncate(filled);
+            self.window_start = pos;
+        }
+        Ok(&self.window[pos - self.window_start..])
+    }
+
+    fn write_at(&mut self, pos: usize, bytes: &[u8]) -> io::Result<()> {
+        self.file.seek(SeekFrom::Start(pos as u64))?;
+        self.file.write_all(bytes)?;
+        self.len = self.len.max(pos + bytes.len());
+        // Drop the read window if it overlaps what we just wrote
+        if pos < self.window_start + self.window.len() && pos + bytes.len() > self.window_start {
+            self.window.clear();
+        }
+        Ok(())
+    }
+}
+
+/** Decode up to `wanted` characters from `chunk` into `buf` at `offset`, optionally stopping after a newline. Returns the characters and bytes read, and whether a newline was found
+ *
+ * Unless `at_end` says the chunk runs to the end of the data, decoding stops before a character which is cut off at the end of the chunk.
+ */
+pub(crate) fn decode_chars(encoding: FileEncoding, chunk: &[u8], buf: &mut GlkArray, offset: usize, wanted: usize, line: bool, at_end: bool) -> (usize, usize, bool) {
+    match encoding {
+        FileEncoding::Latin1 => {
+            let mut count = min(wanted, chunk.len());
+            let newline = line && match simd::find_u8(&chunk[..count], b'\n') {
+                Some(newline) => {
+                    count = newline + 1;
+                    true
+                },
+                None => false,
+            };
+            buf.set_latin1(offset, &chunk[..count]);
+            (count, count, newline)
+        },
+        FileEncoding::UnicodeBE => {
+            let count = min(wanted, chunk.len() / 4);
+            if count == 0 {
+                return (0, 0, false);
+            }
+            let mut newline = false;
+            let mut read = 0;
+            for bytes in chunk[..count * 4].chunks_exact(4) {
+                let ch = u32::from_be_bytes(bytes.try_into().unwrap());
+                buf.set_u32(offset + read, ch);
+                read += 1;
+                if line && ch == 10 {
+                    newline = true;
+                    break;
+                }
+            }
+            (read, read * 4, newline)
+        },
+        FileEncoding::UTF8 => {
+            let mut newline = false;
+            let mut read = 0;
+            let mut used = 0;
+            while read < wanted && used < chunk.len() {
+                if !at_end && chunk.len() - used < utf8_length(chunk[used]) {
+                    break;
+                }
+                let (ch, len) = decode_utf8(&chunk[used..]);
+                buf.set_u32(offset + read, ch);
+                read += 1;
+                used += len;
+                if line && ch == 10 {
+                    newline = true;
+                    break;
+                }
+            }
+            (read, used, newline)
+        },
+    }
+}
+
+/** Decode one UTF-8 character, returning it with its length in bytes. Invalid sequences decode as U+FFFD one byte at a time */
+fn decode_utf8(bytes: &[u8]) -> (u32, usize) {
+    let lead = bytes[0];
+    let len = utf8_length(lead);
+    let (min_ch, initial) = match len {
+        2 => (0x80, lead as u32 & 0x1F),
+        3 => (0x800, lead as u32 & 0x0F),
+        4 => (0x10000, lead as u32 & 0x07),
+        _ if lead < 0x80 => return (lead as u32, 1),
+        _ => return (REPLACEMENT_CHARACTER, 1),
+    };
+    if bytes.len() < len {
+        return (REPLACEMENT_CHARACTER, 1);
+    }
+    let mut ch = initial;
+    for &byte in &bytes[1..len] {
+        if byte & 0xC0 != 0x80 {
+            return (REPLACEMENT_CHARACTER, 1);
+        }
+        ch = (ch << 6) | (byte as u32 & 0x3F);
+    }
+    if ch < min_ch || char::from_u32(ch).is_none() {
+        return (REPLACEMENT_CHARACTER, 1);
+    }
+    (ch, len)
+}
+
+/** The length of the UTF-8 sequence a byte starts, or 1 for a byte which can't start one */
+fn utf8_length(lead: u8) -> usize {
+    match lead {
+        0xC2..=0xDF => 2,
+        0xE0..=0xEF => 3,
+        0xF0..=0xF4 => 4,
+        _ => 1,
+    }
+}
+
+/** Encode one character, returning how many bytes were written */
+fn encode_char(encoding: FileEncoding, ch: u32, dest: &mut [u8]) -> usize {
+    match encoding {
+        FileEncoding::Latin1 => {
+            dest[0] = u8::from_u32(ch);
+            1
+        },
+        FileEncoding::UnicodeBE => {
+            dest[..4].copy_from_slice(&ch.to_be_bytes());
+            4
+        },
+        FileEncoding::UTF8 => char::from_u32(ch).unwrap_or(char::REPLACEMENT_CHARACTER).encode_utf8(dest).len(),
+    }
+}
+
+/** The Stream API has no way to report I/O errors, so they are fatal */
+fn io_result<T>(result: io::Result<T>) -> T {
+    match result {
+        Ok(val) => val,
+        Err(err) => panic!("File stream I/O error: {}", err),
+    }
+}
@@ -0,0 +1,362 @@
+/*
+
+Multi-session host
+==================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::collections::{HashMap, VecDeque};
+use std::io::{self, Write};
+use std::panic::{self, AssertUnwindSafe};
+use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+use std::sync::{Arc, Condvar, Mutex};
+use std::thread::{self, JoinHandle};
+use std::time::Instant;
+
+use super::arena::UpdateArena;
+use super::delta::UpdateTracker;
+use super::deserialise;
+use super::events::EventQueue;
+use super::metrics::{self, record, Metrics};
+use super::protocol::*;
+use super::registry::GlkObjects;
+use super::serialise::Serialise;
+use super::streams::Stream;
+use super::transport::{Transport, TransportWriter};
+use super::windows::layout::Layout;
+
+/** Everything belonging to one Glk session */
+pub struct Session {
+    /** Storage for building updates, which `send` reclaims */
+    pub arena: UpdateArena,
+    id: u64,
+    pub layout: Layout,
+    /** This session's counters, unless they have been swapped in as the current thread's */
+    metrics: Metrics,
+    metrics_current: bool,
+    pub objects: GlkObjects<'static>,
+    output: Box<dyn Write + Send>,
+    tracker: UpdateTracker,
+    /** When the last update was sent, if we haven't had an event since */
+    waiting_since: Option<Instant>,
+    writer: TransportWriter,
+}
+
+impl Session {
+    pub fn new(id: u64, output: Box<dyn Write + Send>) -> Self {
+        Session {
+            arena: UpdateArena::new(),
+            id,
+            layout: Layout::new(),
+            metrics: Metrics::default(),
+            metrics_current: false,
+            objects: GlkObjects::new(),
+            output,
+            tracker: UpdateTracker::new(),
+            waiting_since: None,
+            writer: TransportWriter::new(Transport::Json),
+        }
+    }
+
+    pub fn id(&self) -> u64 {
+        self.id
+    }
+
+    /** A snapshot of this session's counters. They are all zero unless the `metrics` feature is enabled */
+    pub fn metrics(&self) -> Metrics {
+        if self.metrics_current {metrics::current()} else {self.metrics}
+    }
+
+    pub fn transport(&self) -> Transport {
+        self.writer.transport()
+    }
+
+    /** Update the session for an event before the game sees it */
+    pub fn receive(&mut self, event: &Event) {
+        if cfg!(feature = "metrics") {
+            if let Some(since) = self.waiting_since.take() {
+                let waited = since.elapsed();
+                self.metrics.select_wait_time += waited;
+                self.metrics.last_select_wait_time = waited;
+            }
+            self.enter_metrics();
+        }
+        match event {
+            Event::ArrangeEvent(event) => {
+                self.layout.set_metrics(&event.metrics);
+            },
+            Event::InitEvent(event) => {
+                self.layout.set_metrics(&event.metrics);
+                self.tracker.reset();
+                self.writer = TransportWriter::new(Transport::negotiate(event));
+            },
+            _ => {},
+        }
+        self.tracker.event_received(event.base().gen);
+    }
+
+    /** Send an update to the client, leaving out anything it already has. The update's storage is then reclaimed by the session's arena */
+    pub fn send<A: Serialise>(&mut self, mut update: Update<A>) -> io::Result<()> {
+        if let Update::StateUpdate(state) = &mut update {
+            self.tracker.compress(state);
+        }
+        // The turn is over, so write out anything the game's streams have buffered
+        for (_, stream) in self.objects.streams.iter_mut() {
+            stream.flush();
+        }
+        if cfg!(feature = "metrics") {
+            self.enter_metrics();
+            let start = Instant::now();
+            let bytes = self.writer.write(&update).len() as u64;
+            let time = start.elapsed();
+            record!(serialise_time += time);
+            record!(update_bytes += bytes);
+            record!(updates += 1);
+            self.leave_metrics();
+            self.metrics.last_serialise_time = time;
+            self.metrics.last_update_bytes = bytes;
+            self.waiting_since = Some(Instant::now());
+        }
+        else {
+            self.writer.write(&update);
+        }
+        self.arena.reclaim(update);
+        self.writer.write_to(&mut self.output)?;
+        self.output.flush()
+    }
+
+    /** Count what this thread does against this session */
+    fn enter_metrics(&mut self) {
+        if !self.metrics_current {
+            metrics::swap(&mut self.metrics);
+            self.metrics_current = true;
+        }
+    }
+
+    fn leave_metrics(&mut self) {
+        if self.metrics_current {
+            metrics::swap(&mut self.metrics);
+            self.metrics_current = false;
+        }
+    }
+}
+
+/** What a session did with an event */
+#[derive(Clone, Copy, Debug, Eq, PartialEq)]
+pub enum SessionStatus {
+    /** The game has reached `glk_select` again */
+    Waiting,
+    Exited,
+}
+
+/** A game run by a `Host`
+ *
+ * Rather than blocking in `glk_select`, the game must be able to return from `run` when it next calls it, and resume from there when given the next event.
+ */
+pub trait SessionHandler: Send {
+    fn run(&mut self, session: &mut Session, event: Event<'static>) -> SessionStatus;
+}
+
+/** Runs many sessions on a fixed pool of threads
+ *
+ * A session waiting for input is just an entry in a table: it only takes a thread while it has events to handle. A session with new events is pushed onto one of the workers' queues; a worker takes sessions from the front of its own queue, and when that is empty steals from the back of the others'.
+ */
+pub struct Host {
+    shared: Arc<Shared>,
+    threads: Vec<JoinHandle<()>>,
+}
+
+struct Shared {
+    next_id: AtomicU64,
+    /** Which queue to push the next scheduled session onto */
+    next_queue: AtomicUsize,
+    queues: Vec<Mutex<VecDeque<u64>>>,
+    sessions: Mutex<HashMap<u64, Arc<Mutex<Slot>>>>,
+    state: Mutex<PoolState>,
+    wake: Condvar,
+}
+
+struct PoolState {
+    /** Sessions in the queues, so that idle workers know whether to sleep */
+    queued: usize,
+    shutdown: bool,
+}
+
+struct Slot {
+    inbox: EventQueue,
+    /** Whether the session is queued or running */
+    scheduled: bool,
+    /** The session's counters when it last stopped running */
+    metrics: Metrics,
+    /** Taken while the session is running */
+    session: Option<(Session, Box<dyn SessionHandler>)>,
+    transport: Transport,
+}
+
+impl Host {
+    /** Start a host with `threads` workers, or one per CPU if 0 */
+    pub fn new(threads: usize) -> Self {
+        let threads = if threads > 0 {threads} else {thread::available_parallelism().map(|n| n.get()).unwrap_or(1)};
+        let shared = Arc::new(Shared {
+            next_id: AtomicU64::new(1),
+            next_queue: AtomicUsize::new(0),
+            queues: (0..threads).map(|_| Mutex::new(VecDeque::new())).collect(),
+            sessions: Mutex::new(HashMap::new()),
+            state: Mutex::new(PoolState {
+                queued: 0,
+                shutdown: false,
+            }),
+            wake: Condvar::new(),
+        });
+        let threads = (0..threads).map(|index| {
+            let shared = shared.clone();
+            thread::Builder::new()
+                .name(format!("remglk-worker-{}", index))
+                .spawn(move || shared.work(index))
+                .expect("Could not start worker thread")
+        }).collect();
+        Host {
+            shared,
+            threads,
+        }
+    }
+
+    /** Add a session, which will be run when it is first given an event (normally its init event) */
+    pub fn spawn(&self, handler: impl SessionHandler + 'static, output: impl Write + Send + 'static) -> u64 {
+        let id = self.shared.next_id.fetch_add(1, Ordering::Relaxed);
+        let slot = Slot {
+            inbox: EventQueue::new(),
+            metrics: Metrics::default(),
+            scheduled: false,
+            session: Some((Session::new(id, Box::new(output)), Box::new(handler))),
+            transport: Transport::Json,
+        };
+        self.shared.sessions.lock().unwrap().insert(id, Arc::new(Mutex::new(slot)));
+        id
+    }
+
+    /** Queue an event for a session, returning false if there is no such session */
+    pub fn deliver(&self, id: u64, event: Event) -> bool {
+        let slot = match self.shared.sessions.lock().unwrap().get(&id) {
+            Some(slot) => slot.clone(),
+            None => return false,
+        };
+        let mut slot = slot.lock().unwrap();
+        // Settle the transport now, as the client may send its next message before the init event has been handled
+        if let Event::InitEvent(init) = &event {
+            slot.transport = Transport::negotiate(init);
+        }
+        slot.inbox.push(event);
+        if !slot.scheduled {
+            slot.scheduled = true;
+            drop(slot);
+            self.shared.schedule(id);
+        }
+        true
+    }
+
+    /** Parse a message with the session's transport and queue its event */
+    pub fn deliver_message(&self, id: u64, data: &[u8]) -> deserialise::Result<bool> {
+        let transport = match self.shared.sessions.lock().unwrap().get(&id) {
+            Some(slot) => slot.lock().unwrap().transport,
+            None => return Ok(false),
+        };
+        Ok(self.deliver(id, transport.parse_event(data)?))
+    }
+
+    /** A snapshot of a session's counters, as of when it last finished handling its events */
+    pub fn metrics(&self, id: u64) -> Option<Metrics> {
+        let slot = self.shared.sessions.lock().unwrap().get(&id)?.clone();
+        let metrics = slot.lock().unwrap().metrics;
+        Some(metrics)
+    }
+
+    pub fn session_count(&self) -> usize {
+        self.shared.sessions.lock().unwrap().len()
+    }
+}
+
+impl Drop for Host {
+    fn drop(&mut self) {
+        self.shared.state.lock().unwrap().shutdown = true;
+        self.shared.wake.notify_all();
+        for thread in self.threads.drain(..) {
+            let _ = thread.join();
+        }
+    }
+}
+
+impl Shared {
+    fn schedule(&self, id: u64) {
+        let queue = self.next_queue.fetch_add(1, Ordering::Relaxed) % self.queues.len();
+        // Count the session before it can be taken, or a worker could decrement `queued` first
+        let mut state = self.state.lock().unwrap();
+        state.queued += 1;
+        self.queues[queue].lock().unwrap().push_back(id);
+        drop(state);
+        self.wake.notify_one();
+    }
+
+    fn work(&self, index: usize) {
+        loop {
+            {
+                let mut state = self.state.lock().unwrap();
+                while state.queued == 0 && !state.shutdown {
+                    state = self.wake.wait(state).unwrap();
+                }
+                if state.shutdown {
+                    return;
+                }
+            }
+            if let Some(id) = self.next_session(index) {
+                self.state.lock().unwrap().queued -= 1;
+                self.run(id);
+            }
+        }
+    }
+
+    /** Take from our own queue, or steal from another */
+    fn next_session(&self, index: usize) -> Option<u64> {
+        if let Some(id) = self.queues[index].lock().unwrap().pop_front() {
+            return Some(id);
+        }
+        let count = self.queues.len();
+        (1..count).find_map(|offset| self.queues[(index + offset) % count].lock().unwrap().pop_back())
+    }
+
+    /** Run a session until it has handled all of its events */
+    fn run(&self, id: u64) {
+        let slot = match self.sessions.lock().unwrap().get(&id) {
+            Some(slot) => slot.clone(),
+            None => return,
+        };
+        let (mut session, mut handler) = slot.lock().unwrap().session.take().unwrap();
+        loop {
+            let event = {
+                let mut slot = slot.lock().unwrap();
+                match slot.inbox.pop() {
+                    Some(event) => event,
+                    None => {
+                        // The handler may not have sent an update
+                        session.leave_metrics();
+                        slot.metrics = session.metrics;
+                        slot.scheduled = false;
+                        slot.session = Some((session, handler));
+                        return;
+                    },
+                }
+            };
+            session.receive(&event);
+            // A panicking game only takes down its own session
+            let status = panic::catch_unwind(AssertUnwindSafe(|| handler.run(&mut session, event)));
+            if status.unwrap_or(SessionStatus::Exited) == SessionStatus::Exited {
+                self.sessions.lock().unwrap().remove(&id);
+                return;
+            }
+        }
+    }
+}
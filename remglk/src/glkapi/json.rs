@@ -0,0 +1,496 @@
+/*
+
+JSON encoding
+=============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::borrow::Cow;
+use std::io::{self, Write};
+
+use super::deserialise::*;
+use super::protocol::Event;
+use super::serialise::*;
+
+/** Parse one input event from a JSON string */
+pub fn parse_event(json: &str) -> Result<Event<'_>> {
+    let mut reader = JsonReader::new(json);
+    let event = deserialise_event(&mut reader)?;
+    reader.finish()?;
+    Ok(event)
+}
+
+/** A streaming JSON writer, which writes into a reusable output buffer */
+#[derive(Default)]
+pub struct JsonWriter {
+    buf: Vec<u8>,
+    /** Whether the next value or key needs a comma before it */
+    needs_comma: bool,
+}
+
+impl JsonWriter {
+    pub fn new() -> Self {
+        JsonWriter::default()
+    }
+
+    pub fn as_bytes(&self) -> &[u8] {
+        &self.buf
+    }
+
+    /** Empty the output buffer, keeping its capacity */
+    pub fn clear(&mut self) {
+        self.buf.clear();
+        self.needs_comma = false;
+    }
+
+    pub fn into_inner(self) -> Vec<u8> {
+        self.buf
+    }
+
+    /** Serialise a value, replacing whatever was in the buffer */
+    pub fn write<T: Serialise + ?Sized>(&mut self, val: &T) -> &[u8] {
+        self.clear();
+        val.serialise(self);
+        &self.buf
+    }
+
+    /** Write the buffer out, followed by a newline */
+    pub fn write_to<W: Write>(&self, output: &mut W) -> io::Result<()> {
+        output.write_all(&self.buf)?;
+        output.write_all(b"\n")?;
+        output.flush()
+    }
+
+    fn comma(&mut self) {
+        if self.needs_comma {
+            self.buf.push(b',');
+        }
+    }
+
+    fn escape_str(&mut self, val: &str) {
+        let bytes = val.as_bytes();
+        self.buf.reserve(bytes.len() + 2);
+        self.buf.push(b'"');
+        let mut run_start = 0;
+        for (i, &byte) in bytes.iter().enumerate() {
+            let escape = ESCAPES[byte as usize];
+            if escape == 0 {
+                continue;
+            }
+            // Copy the run of characters that don't need escaping in one go
+            self.buf.extend_from_slice(&bytes[run_start..i]);
+            run_start = i + 1;
+            if escape == b'u' {
+                const HEX: &[u8; 16] = b"0123456789abcdef";
+                self.buf.extend_from_slice(&[b'\\', b'u', b'0', b'0', HEX[(byte >> 4) as usize], HEX[(byte & 0xF) as usize]]);
+            }
+            else {
+                self.buf.extend_from_slice(&[b'\\', escape]);
+            }
+        }
+        self.buf.extend_from_slice(&bytes[run_start..]);
+        self.buf.push(b'"');
+    }
+}
+
+impl Serialiser for JsonWriter {
+    fn begin_array(&mut self) {
+        self.comma();
+        self.buf.push(b'[');
+        self.needs_comma = false;
+    }
+
+    fn begin_object(&mut self) {
+        self.comma();
+        self.buf.push(b'{');
+        self.needs_comma = false;
+    }
+
+    fn bool(&mut self, val: bool) {
+        self.comma();
+        self.buf.extend_from_slice(if val {b"true"} else {b"false"});
+        self.needs_comma = true;
+    }
+
+    fn end_array(&mut self) {
+        self.buf.push(b']');
+        self.needs_comma = true;
+    }
+
+    fn end_object(&mut self) {
+        self.buf.push(b'}');
+        self.needs_comma = true;
+    }
+
+    fn f64(&mut self, val: f64) {
+        if !val.is_finite() {
+            return self.null();
+        }
+        self.comma();
+        // Whole numbers (the common case for metrics) are written without a fractional part
+        if val.fract() == 0.0 && val.abs() < 4294967296.0 {
+            if val < 0.0 {
+                self.buf.push(b'-');
+            }
+            write_u32(&mut self.buf, val.abs() as u32);
+        }
+        else {
+            write!(self.buf, "{}", val).unwrap();
+        }
+        self.needs_comma = true;
+    }
+
+    fn key(&mut self, key: &str) {
+        self.comma();
+        self.escape_str(key);
+        self.buf.push(b':');
+        self.needs_comma = false;
+    }
+
+    fn null(&mut self) {
+        self.comma();
+        self.buf.extend_from_slice(b"null");
+        self.needs_comma = true;
+    }
+
+    fn str(&mut self, val: &str) {
+        self.comma();
+        self.escape_str(val);
+        self.needs_comma = true;
+    }
+
+    fn u32(&mut self, val: u32) {
+        self.comma();
+        write_u32(&mut self.buf, val);
+        self.needs_comma = true;
+    }
+}
+
+fn write_u32(buf: &mut Vec<u8>, mut val: u32) {
+    let mut digits = [0u8; 10];
+    let mut i = digits.len();
+    loop {
+        i -= 1;
+        digits[i] = b'0' + (val % 10) as u8;
+        val /= 10;
+        if val == 0 {
+            break;
+        }
+    }
+    buf.extend_from_slice(&digits[i..]);
+}
+
+/** For each byte, 0 if it can be written as is, `u` for a \u escape, or the character for a short escape */
+static ESCAPES: [u8; 256] = {
+    let mut table = [0u8; 256];
+    let mut i = 0;
+    while i < 0x20 {
+        table[i] = b'u';
+        i += 1;
+    }
+    table[0x08] = b'b';
+    table[0x09] = b't';
+    table[0x0A] = b'n';
+    table[0x0C] = b'f';
+    table[0x0D] = b'r';
+    table[b'"' as usize] = b'"';
+    table[b'\\' as usize] = b'\\';
+    table
+};
+
+/** A JSON pull parser which borrows strings from its input */
+pub struct JsonReader<'a> {
+    /** How many arrays and objects are open */
+    depth: usize,
+    input: &'a str,
+    /** Whether we're at the start of an array or object, where no comma is needed */
+    first: bool,
+    pos: usize,
+}
+
+impl<'a> JsonReader<'a> {
+    pub fn new(input: &'a str) -> Self {
+        JsonReader {
+            depth: 0,
+            input,
+            first: false,
+            pos: 0,
+        }
+    }
+
+    /** Check there's nothing but whitespace after the value */
+    pub fn finish(&mut self) -> Result<()> {
+        self.skip_whitespace();
+        if self.pos < self.input.len() {
+            return Err(self.error("Unexpected data after JSON value"));
+        }
+        Ok(())
+    }
+
+    /** The current byte offset into the input */
+    pub fn position(&self) -> usize {
+        self.pos
+    }
+
+    fn expect(&mut self, byte: u8) -> Result<()> {
+        self.skip_whitespace();
+        if self.peek_byte() != Some(byte) {
+            return Err(self.error(match byte {
+                b'{' => "Expected an object",
+                b'[' => "Expected an array",
+                b':' => "Expected a colon",
+                b',' => "Expected a comma",
+                _ => "Unexpected character",
+            }));
+        }
+        self.pos += 1;
+        Ok(())
+    }
+
+    /** Open an array or object */
+    fn enter(&mut self, byte: u8) -> Result<()> {
+        self.expect(byte)?;
+        if self.depth == MAX_DEPTH {
+            return Err(self.error("Too deeply nested"));
+        }
+        self.depth += 1;
+        self.first = true;
+        Ok(())
+    }
+
+    fn expect_literal(&mut self, literal: &str) -> Result<()> {
+        self.skip_whitespace();
+        if !self.input[self.pos..].starts_with(literal) {
+            return Err(self.error("Invalid literal"));
+        }
+        self.pos += literal.len();
+        Ok(())
+    }
+
+    fn number_slice(&mut self) -> Result<&'a str> {
+        self.skip_whitespace();
+        let bytes = self.input.as_bytes();
+        let start = self.pos;
+        while self.pos < bytes.len() && matches!(bytes[self.pos], b'0'..=b'9' | b'-' | b'+' | b'.' | b'e' | b'E') {
+            self.pos += 1;
+        }
+        if start == self.pos {
+            return Err(self.error("Expected a number"));
+        }
+        Ok(&self.input[start..self.pos])
+    }
+
+    fn peek_byte(&self) -> Option<u8> {
+        self.input.as_bytes().get(self.pos).copied()
+    }
+
+    fn skip_whitespace(&mut self) {
+        let bytes = self.input.as_bytes();
+        while self.pos < bytes.len() && matches!(bytes[self.pos], b' ' | b'\t' | b'\n' | b'\r') {
+            self.pos += 1;
+        }
+    }
+
+    /** Unescape a string, starting from the first backslash */
+    fn unescape(&mut self, start: usize) -> Result<String> {
+        let bytes = self.input.as_bytes();
+        let mut result = String::with_capacity(self.pos - start + 16);
+        result.push_str(&self.input[start..self.pos]);
+        loop {
+            let run_start = self.pos;
+            while self.pos < bytes.len() && bytes[self.pos] != b'"' && bytes[self.pos] != b'\\' {
+                self.pos += 1;
+            }
+            result.push_str(&self.input[run_start..self.pos]);
+            match self.peek_byte() {
+                Some(b'"') => {
+                    self.pos += 1;
+                    return Ok(result);
+                },
+                Some(_) => {
+                    self.pos += 1;
+                    let escape = self.peek_byte().ok_or_else(|| self.error("Unterminated string"))?;
+                    self.pos += 1;
+                    match escape {
+                        b'"' => result.push('"'),
+                        b'\\' => result.push('\\'),
+                        b'/' => result.push('/'),
+                        b'b' => result.push('\u{8}'),
+                        b'f' => result.push('\u{C}'),
+                        b'n' => result.push('\n'),
+                        b'r' => result.push('\r'),
+                        b't' => result.push('\t'),
+                        b'u' => {
+                            let mut ch = self.hex4()?;
+                            if (0xD800..0xDC00).contains(&ch) && self.input[self.pos..].starts_with("\\u") {
+                                let high_end = self.pos;
+                                self.pos += 2;
+                                let low = self.hex4()?;
+                                if (0xDC00..0xE000).contains(&low) {
+                                    ch = 0x10000 + ((ch - 0xD800) << 10) + (low - 0xDC00);
+                                }
+                                else {
+                                    // Not a low surrogate, so leave it to be decoded by itself
+                                    self.pos = high_end;
+                                }
+                            }
+                            result.push(char::from_u32(ch).unwrap_or(char::REPLACEMENT_CHARACTER));
+                        },
+                        _ => return Err(self.error("Invalid escape")),
+                    }
+                },
+                None => return Err(self.error("Unterminated string")),
+            }
+        }
+    }
+
+    fn hex4(&mut self) -> Result<u32> {
+        let digits = self.input.get(self.pos..self.pos + 4).ok_or_else(|| self.error("Invalid unicode escape"))?;
+        // from_str_radix would also accept a sign
+        if !digits.bytes().all(|byte| byte.is_ascii_hexdigit()) {
+            return Err(self.error("Invalid unicode escape"));
+        }
+        self.pos += 4;
+        Ok(u32::from_str_radix(digits, 16).unwrap())
+    }
+}
+
+impl<'a> Deserialiser<'a> for JsonReader<'a> {
+    fn begin_array(&mut self) -> Result<()> {
+        self.enter(b'[')
+    }
+
+    fn begin_object(&mut self) -> Result<()> {
+        self.enter(b'{')
+    }
+
+    fn bool(&mut self) -> Result<bool> {
+        self.skip_whitespace();
+        if self.peek_byte() == Some(b't') {
+            self.expect_literal("true")?;
+            return Ok(true);
+        }
+        self.expect_literal("false")?;
+        Ok(false)
+    }
+
+    fn error(&self, reason: &'static str) -> DeserialiseError {
+        DeserialiseError {
+            offset: self.pos,
+            reason,
+        }
+    }
+
+    fn f64(&mut self) -> Result<f64> {
+        self.number_slice()?.parse().map_err(|_| self.error("Invalid number"))
+    }
+
+    fn next_element(&mut self) -> Result<bool> {
+        self.skip_whitespace();
+        if self.peek_byte() == Some(b']') {
+            self.pos += 1;
+            self.depth -= 1;
+            self.first = false;
+            return Ok(false);
+        }
+        if !self.first {
+            self.expect(b',')?;
+        }
+        self.first = false;
+        Ok(true)
+    }
+
+    fn next_key(&mut self) -> Result<Option<Cow<'a, str>>> {
+        self.skip_whitespace();
+        if self.peek_byte() == Some(b'}') {
+            self.pos += 1;
+            self.depth -= 1;
+            self.first = false;
+            return Ok(None);
+        }
+        if !self.first {
+            self.expect(b',')?;
+        }
+        self.first = false;
+        let key = self.str()?;
+        self.expect(b':')?;
+        Ok(Some(key))
+    }
+
+    fn null(&mut self) -> Result<()> {
+        self.expect_literal("null")
+    }
+
+    fn peek(&mut self) -> Result<ValueKind> {
+        self.skip_whitespace();
+        Ok(match self.peek_byte() {
+            Some(b'[') => ValueKind::Array,
+            Some(b't' | b'f') => ValueKind::Bool,
+            Some(b'n') => ValueKind::Null,
+            Some(b'-' | b'0'..=b'9') => ValueKind::Number,
+            Some(b'{') => ValueKind::Object,
+            Some(b'"') => ValueKind::String,
+            _ => return Err(self.error("Expected a value")),
+        })
+    }
+
+    fn str(&mut self) -> Result<Cow<'a, str>> {
+        self.skip_whitespace();
+        if self.peek_byte() != Some(b'"') {
+            return Err(self.error("Expected a string"));
+        }
+        self.pos += 1;
+        let start = self.pos;
+        let bytes = self.input.as_bytes();
+        while self.pos < bytes.len() {
+            match bytes[self.pos] {
+                b'"' => {
+                    self.pos += 1;
+                    return Ok(Cow::Borrowed(&self.input[start..self.pos - 1]));
+                },
+                b'\\' => return self.unescape(start).map(Cow::Owned),
+                _ => self.pos += 1,
+            }
+        }
+        Err(self.error("Unterminated string"))
+    }
+
+    fn u32(&mut self) -> Result<u32> {
+        let digits = self.number_slice()?;
+        if digits.len() <= 9 && digits.bytes().all(|b| b.is_ascii_digit()) {
+            return Ok(digits.bytes().fold(0, |val, b| val * 10 + (b - b'0') as u32));
+        }
+        let val: f64 = digits.parse().map_err(|_| self.error("Invalid number"))?;
+        if val < 0.0 || val > u32::MAX as f64 || val.fract() != 0.0 {
+            return Err(self.error("Expected an unsigned integer"));
+        }
+        Ok(val as u32)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn unescape(json: &str) -> Result<String> {
+        JsonReader::new(json).str().map(Cow::into_owned)
+    }
+
+    #[test]
+    fn unicode_escapes() {
+        assert_eq!(unescape(r#""A\u00e9\u4e2d""#).unwrap(), "A\u{E9}\u{4E2D}");
+        assert_eq!(unescape(r#""\ud83d\ude00""#).unwrap(), "\u{1F600}");
+        // Unpaired surrogates become replacement characters, without swallowing what follows
+        assert_eq!(unescape(r#""\ud800\u0041""#).unwrap(), "\u{FFFD}A");
+        assert_eq!(unescape(r#""\ud800\ud83d\ude00""#).unwrap(), "\u{FFFD}\u{1F600}");
+        assert_eq!(unescape(r#""\ud800x""#).unwrap(), "\u{FFFD}x");
+        assert_eq!(unescape(r#""\ude00""#).unwrap(), "\u{FFFD}");
+        for bad in [r#""\u+041""#, r#""\u-041""#, r#""\u004""#, r#""\u00g1""#, r#""\ud800\u+041""#] {
+            assert!(unescape(bad).is_err(), "{}", bad);
+        }
+    }
+}
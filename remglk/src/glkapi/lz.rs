@@ -0,0 +1,203 @@
+/*
+
+LZ compression
+==============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::io;
+
+/*
+
+A small LZ77 compressor for text, using the LZ4 block format: each sequence is a token byte (literal count in the high nibble, match length minus 4 in the low nibble, with 15 meaning more length bytes follow), the literals, then a little endian u16 offset back to the match. The final sequence is only literals.
+
+Matches are found with a hash table of the last position each four byte sequence was seen, which is fast and good enough for game transcripts.
+
+*/
+
+const HASH_BITS: u32 = 12;
+const MAX_OFFSET: usize = 0xFFFF;
+const MIN_MATCH: usize = 4;
+
+fn hash(bytes: &[u8]) -> usize {
+    let val = u32::from_le_bytes(bytes[..4].try_into().unwrap());
+    (val.wrapping_mul(2654435761) >> (32 - HASH_BITS)) as usize
+}
+
+fn write_length(out: &mut Vec<u8>, mut len: usize) {
+    while len >= 255 {
+        out.push(255);
+        len -= 255;
+    }
+    out.push(len as u8);
+}
+
+fn write_sequence(out: &mut Vec<u8>, literals: &[u8], offset: usize, match_len: usize) {
+    let literal_nibble = literals.len().min(15);
+    let match_nibble = if match_len > 0 {(match_len - MIN_MATCH).min(15)} else {0};
+    out.push((literal_nibble << 4 | match_nibble) as u8);
+    if literal_nibble == 15 {
+        write_length(out, literals.len() - 15);
+    }
+    out.extend_from_slice(literals);
+    if match_len > 0 {
+        out.extend_from_slice(&(offset as u16).to_le_bytes());
+        if match_nibble == 15 {
+            write_length(out, match_len - MIN_MATCH - 15);
+        }
+    }
+}
+
+/** Compress `input`, appending to `out` */
+pub fn compress(input: &[u8], out: &mut Vec<u8>) {
+    let mut table = vec![usize::MAX; 1 << HASH_BITS];
+    let mut literal_start = 0;
+    let mut pos = 0;
+    while pos + MIN_MATCH <= input.len() {
+        let slot = &mut table[hash(&input[pos..])];
+        let candidate = *slot;
+        *slot = pos;
+        if candidate != usize::MAX && pos - candidate <= MAX_OFFSET && input[candidate..candidate + MIN_MATCH] == input[pos..pos + MIN_MATCH] {
+            let match_len = MIN_MATCH + input[pos + MIN_MATCH..].iter().zip(&input[candidate + MIN_MATCH..]).take_while(|(a, b)| a == b).count();
+            write_sequence(out, &input[literal_start..pos], pos - candidate, match_len);
+            pos += match_len;
+            literal_start = pos;
+        }
+        else {
+            pos += 1;
+        }
+    }
+    write_sequence(out, &input[literal_start..], 0, 0);
+}
+
+/** Decompress data made by `compress`, which should decompress to `len` bytes, appending to `out` */
+pub fn decompress(input: &[u8], len: usize, out: &mut Vec<u8>) -> io::Result<()> {
+    let invalid = || io::Error::new(io::ErrorKind::InvalidData, "Corrupt compressed data");
+    let start = out.len();
+    // Don't trust `len` for more than the input could possibly expand to
+    out.reserve(len.min(input.len().saturating_mul(255)));
+    let mut pos = 0;
+    let read_length = |pos: &mut usize, mut len: usize| -> io::Result<usize> {
+        loop {
+            let byte = *input.get(*pos).ok_or_else(invalid)?;
+            *pos += 1;
+            len += byte as usize;
+            if byte != 255 {
+                return Ok(len);
+            }
+        }
+    };
+    while pos < input.len() {
+        let token = input[pos];
+        pos += 1;
+        let mut literals = (token >> 4) as usize;
+        if literals == 15 {
+            literals = read_length(&mut pos, literals)?;
+        }
+        let literals = input.get(pos..pos + literals).ok_or_else(invalid)?;
+        out.extend_from_slice(literals);
+        pos += literals.len();
+        if pos == input.len() {
+            break;
+        }
+        let offset = u16::from_le_bytes(input.get(pos..pos + 2).ok_or_else(invalid)?.try_into().unwrap()) as usize;
+        pos += 2;
+        let mut match_len = (token & 0xF) as usize;
+        if match_len == 15 {
+            match_len = read_length(&mut pos, match_len)?;
+        }
+        match_len += MIN_MATCH;
+        if offset == 0 || offset > out.len() - start || out.len() - start + match_len > len {
+            return Err(invalid());
+        }
+        // Matches may overlap what they are copying, so copy a byte at a time
+        let from = out.len() - offset;
+        for i in 0..match_len {
+            out.push(out[from + i]);
+        }
+    }
+    if out.len() - start != len {
+        return Err(invalid());
+    }
+    Ok(())
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn round_trip(input: &[u8]) -> Vec<u8> {
+        let mut compressed = Vec::new();
+        compress(input, &mut compressed);
+        let mut out = Vec::new();
+        decompress(&compressed, input.len(), &mut out).unwrap();
+        assert_eq!(out, input);
+        compressed
+    }
+
+    fn is_invalid(input: &[u8], len: usize) -> bool {
+        let mut out = Vec::new();
+        matches!(decompress(input, len, &mut out), Err(err) if err.kind() == io::ErrorKind::InvalidData)
+    }
+
+    #[test]
+    fn empty() {
+        assert_eq!(round_trip(b""), [0]);
+        round_trip(b"abc");
+    }
+
+    #[test]
+    fn overlapping_matches() {
+        // Each match copies bytes it has itself just written
+        let compressed = round_trip(&[b'a'; 100]);
+        assert!(compressed.len() < 10);
+        round_trip(&b"ab".repeat(50));
+        round_trip(&b"abc".repeat(7));
+    }
+
+    #[test]
+    fn long_lengths() {
+        // Matches of 19 or more bytes and literal runs of 15 or more need extra length bytes, including ones of 255
+        let text = b"You are standing in an open field west of a white house.";
+        round_trip(&text.repeat(2));
+        round_trip(&text.repeat(30));
+        let literals: Vec<u8> = (0..=255u8).chain(0..=255u8).map(|byte| byte.wrapping_mul(167)).collect();
+        round_trip(&literals[..300]);
+        round_trip(&[&literals[..270], &[b'z'; 800][..], &literals[300..]].concat());
+    }
+
+    #[test]
+    fn appends_to_output() {
+        let mut compressed = Vec::new();
+        compress(b"hello hello hello", &mut compressed);
+        let mut out = b"prefix".to_vec();
+        decompress(&compressed, 17, &mut out).unwrap();
+        assert_eq!(out, b"prefixhello hello hello");
+        // A match can't reach back into what was already there
+        let mut out = b"prefix".to_vec();
+        assert!(decompress(&[0x00, 0x01, 0x00], 4, &mut out).is_err());
+    }
+
+    #[test]
+    fn corrupt() {
+        let mut compressed = Vec::new();
+        compress(&b"the quick brown fox ".repeat(10), &mut compressed);
+        // The last byte is an empty final sequence, which can be left off
+        assert_eq!(compressed.last(), Some(&0));
+        for len in 1..compressed.len() - 1 {
+            assert!(is_invalid(&compressed[..len], 200));
+        }
+        // The wrong length
+        assert!(is_invalid(&compressed, 199));
+        assert!(is_invalid(&compressed, 201));
+        // An offset of 0, and one before the start
+        assert!(is_invalid(&[0x10, b'a', 0x00, 0x00], 5));
+        assert!(is_invalid(&[0x10, b'a', 0x02, 0x00], 5));
+        // Length bytes which run off the end
+        assert!(is_invalid(&[0xF0, 0xFF], 300));
+    }
+}
@@ -0,0 +1,155 @@
+/*
+
+Session metrics
+===============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+/*
+
+Counters are only kept when the `metrics` feature is enabled; otherwise the `record!` macro expands to nothing and every function here is empty.
+
+Streams and windows don't know which session they belong to, so counts go to the current thread's counters. A `Session` swaps its own counters in when it receives an event and out again when it sends its update, so everything the game does in between is counted against it. Time between sending an update and receiving the next event is counted as waiting in `glk_select`.
+
+Allocations are only counted if the host installs `CountingAllocator` as its global allocator.
+
+*/
+
+use std::alloc::{GlobalAlloc, Layout, System};
+#[cfg(feature = "metrics")]
+use std::cell::{Cell, RefCell};
+use std::time::Duration;
+
+/** A snapshot of a session's counters */
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct Metrics {
+    /** Allocations made while the session was current. Needs `CountingAllocator` */
+    pub allocations: u64,
+    pub allocated_bytes: u64,
+    pub put_buffer_calls: u64,
+    /** Characters passed to `put_buffer` */
+    pub put_buffer_chars: u64,
+    pub put_char_calls: u64,
+    pub put_string_calls: u64,
+    /** Bytes passed to `put_string` */
+    pub put_string_bytes: u64,
+    /** Totals of the `StreamResult`s of closed streams */
+    pub stream_read_count: u64,
+    pub stream_write_count: u64,
+    /** Time spent serialising updates */
+    pub serialise_time: Duration,
+    pub last_serialise_time: Duration,
+    /** Time spent waiting in `glk_select` for events */
+    pub select_wait_time: Duration,
+    pub last_select_wait_time: Duration,
+    /** How many updates have been sent */
+    pub updates: u64,
+    /** Bytes of update output */
+    pub update_bytes: u64,
+    pub last_update_bytes: u64,
+}
+
+#[cfg(feature = "metrics")]
+thread_local! {
+    pub(crate) static CURRENT: RefCell<Metrics> = const {RefCell::new(Metrics {
+        allocations: 0,
+        allocated_bytes: 0,
+        put_buffer_calls: 0,
+        put_buffer_chars: 0,
+        put_char_calls: 0,
+        put_string_calls: 0,
+        put_string_bytes: 0,
+        stream_read_count: 0,
+        stream_write_count: 0,
+        serialise_time: Duration::ZERO,
+        last_serialise_time: Duration::ZERO,
+        select_wait_time: Duration::ZERO,
+        last_select_wait_time: Duration::ZERO,
+        updates: 0,
+        update_bytes: 0,
+        last_update_bytes: 0,
+    })};
+    /** Kept apart from CURRENT so that the allocator never has to borrow it */
+    static ALLOCATIONS: Cell<(u64, u64)> = const {Cell::new((0, 0))};
+}
+
+/** Add to a counter of the current thread's session: `record!(put_char_calls += 1)` */
+#[cfg(feature = "metrics")]
+macro_rules! record {
+    ($field:ident += $val:expr) => {
+        $crate::glkapi::metrics::CURRENT.with(|metrics| metrics.borrow_mut().$field += $val)
+    };
+}
+#[cfg(not(feature = "metrics"))]
+macro_rules! record {
+    ($field:ident += $val:expr) => {};
+}
+pub(crate) use record;
+
+/** Swap some counters with the current thread's */
+#[cfg(feature = "metrics")]
+pub(crate) fn swap(metrics: &mut Metrics) {
+    let allocations = (metrics.allocations, metrics.allocated_bytes);
+    CURRENT.with(|current| std::mem::swap(&mut *current.borrow_mut(), metrics));
+    (metrics.allocations, metrics.allocated_bytes) = ALLOCATIONS.with(|current| current.replace(allocations));
+}
+#[cfg(not(feature = "metrics"))]
+#[inline(always)]
+pub(crate) fn swap(_metrics: &mut Metrics) {}
+
+/** A copy of the current thread's counters */
+pub fn current() -> Metrics {
+    #[cfg(feature = "metrics")]
+    {
+        let mut metrics = CURRENT.with(|current| *current.borrow());
+        (metrics.allocations, metrics.allocated_bytes) = ALLOCATIONS.with(Cell::get);
+        metrics
+    }
+    #[cfg(not(feature = "metrics"))]
+    Metrics::default()
+}
+
+/** A global allocator which counts allocations against the current session
+ *
+ * Install it with `#[global_allocator] static ALLOCATOR: CountingAllocator = CountingAllocator;`. Without the `metrics` feature it is just the system allocator.
+ */
+pub struct CountingAllocator;
+
+unsafe impl GlobalAlloc for CountingAllocator {
+    #[inline]
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        count_allocation(layout.size());
+        System.alloc(layout)
+    }
+
+    #[inline]
+    unsafe fn alloc_zeroed(&self, layout: Layout) -> *mut u8 {
+        count_allocation(layout.size());
+        System.alloc_zeroed(layout)
+    }
+
+    #[inline]
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        System.dealloc(ptr, layout)
+    }
+
+    #[inline]
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        count_allocation(new_size);
+        System.realloc(ptr, layout, new_size)
+    }
+}
+
+#[inline(always)]
+fn count_allocation(_size: usize) {
+    // The thread local may already be gone while a thread is exiting
+    #[cfg(feature = "metrics")]
+    let _ = ALLOCATIONS.try_with(|current| {
+        let (allocations, bytes) = current.get();
+        current.set((allocations + 1, bytes + _size as u64));
+    });
+}
@@ -0,0 +1,142 @@
+/*
+
+Memory mapped files
+===================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::fs::File;
+use std::io;
+
+/** A whole file mapped into memory
+ *
+ * Only supported on 64 bit Unix platforms; elsewhere `map` returns `ErrorKind::Unsupported` and callers should fall back to normal file I/O.
+ */
+pub struct MappedFile {
+    len: usize,
+    ptr: *mut u8,
+    writable: bool,
+}
+
+// The mapping is plain memory, so it can be shared like a `Box<[u8]>`
+unsafe impl Send for MappedFile {}
+unsafe impl Sync for MappedFile {}
+
+impl MappedFile {
+    /** Map the file's current length. A read only mapping is made unless `writable` is set */
+    pub fn map(file: &File, writable: bool) -> io::Result<MappedFile> {
+        let len = file.metadata()?.len() as usize;
+        if len == 0 {
+            return Ok(MappedFile {
+                len: 0,
+                ptr: std::ptr::NonNull::dangling().as_ptr(),
+                writable,
+            });
+        }
+        let ptr = sys::map(file, len, writable)?;
+        Ok(MappedFile {
+            len,
+            ptr,
+            writable,
+        })
+    }
+
+    pub fn as_slice(&self) -> &[u8] {
+        unsafe {std::slice::from_raw_parts(self.ptr, self.len)}
+    }
+
+    pub fn as_mut_slice(&mut self) -> &mut [u8] {
+        if !self.writable {
+            panic!("Cannot write to read-only mapping")
+        }
+        unsafe {std::slice::from_raw_parts_mut(self.ptr, self.len)}
+    }
+
+    /** Schedule any changes to be written back to the file */
+    pub fn flush(&self) -> io::Result<()> {
+        if self.writable && self.len > 0 {
+            sys::flush(self.ptr, self.len)?;
+        }
+        Ok(())
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn writable(&self) -> bool {
+        self.writable
+    }
+}
+
+impl Drop for MappedFile {
+    fn drop(&mut self) {
+        if self.len > 0 {
+            sys::unmap(self.ptr, self.len);
+        }
+    }
+}
+
+#[cfg(all(unix, target_pointer_width = "64"))]
+mod sys {
+    use std::ffi::{c_int, c_void};
+    use std::fs::File;
+    use std::io;
+    use std::os::fd::AsRawFd;
+
+    const PROT_READ: c_int = 1;
+    const PROT_WRITE: c_int = 2;
+    const MAP_SHARED: c_int = 1;
+    const MS_ASYNC: c_int = 1;
+
+    extern "C" {
+        fn mmap(addr: *mut c_void, len: usize, prot: c_int, flags: c_int, fd: c_int, offset: i64) -> *mut c_void;
+        fn msync(addr: *mut c_void, len: usize, flags: c_int) -> c_int;
+        fn munmap(addr: *mut c_void, len: usize) -> c_int;
+    }
+
+    pub fn map(file: &File, len: usize, writable: bool) -> io::Result<*mut u8> {
+        let prot = if writable {PROT_READ | PROT_WRITE} else {PROT_READ};
+        let ptr = unsafe {mmap(std::ptr::null_mut(), len, prot, MAP_SHARED, file.as_raw_fd(), 0)};
+        // MAP_FAILED is (void *) -1
+        if ptr as isize == -1 {
+            return Err(io::Error::last_os_error());
+        }
+        Ok(ptr as *mut u8)
+    }
+
+    pub fn flush(ptr: *mut u8, len: usize) -> io::Result<()> {
+        if unsafe {msync(ptr as *mut c_void, len, MS_ASYNC)} != 0 {
+            return Err(io::Error::last_os_error());
+        }
+        Ok(())
+    }
+
+    pub fn unmap(ptr: *mut u8, len: usize) {
+        unsafe {munmap(ptr as *mut c_void, len)};
+    }
+}
+
+#[cfg(not(all(unix, target_pointer_width = "64")))]
+mod sys {
+    use std::fs::File;
+    use std::io;
+
+    pub fn map(_file: &File, _len: usize, _writable: bool) -> io::Result<*mut u8> {
+        Err(io::ErrorKind::Unsupported.into())
+    }
+
+    pub fn flush(_ptr: *mut u8, _len: usize) -> io::Result<()> {
+        Ok(())
+    }
+
+    pub fn unmap(_ptr: *mut u8, _len: usize) {}
+}
@@ -11,9 +11,33 @@ https://github.com/curiousdannii/remglk-rs
 
 use std::cmp::min;
 
+pub mod arena;
+pub mod atoms;
+pub mod blorb;
 pub mod constants;
+pub mod delta;
+pub mod deserialise;
+pub mod events;
+pub mod file_streams;
+pub mod host;
+pub mod json;
+mod lz;
+pub mod metrics;
+pub mod mmap;
+pub mod msgpack;
+pub mod pool;
 pub mod protocol;
+pub mod registry;
+pub mod select;
+pub mod serialise;
+pub mod snapshot;
+pub mod snapshot_log;
+mod simd;
 pub mod streams;
+pub mod timers;
+pub mod transport;
+pub mod unicode;
+pub mod windows;
 
 pub const MAX_LATIN1: u32 = 0xFF;
 pub const QUESTION_MARK: u32 = '?' as u32;
@@ -33,6 +57,14 @@ impl GlkArray<'_> {
         }
     }
 
+    /** Find the first newline in a range of this array */
+    pub fn find_newline(&self, start: usize, end: usize) -> Option<usize> {
+        match self {
+            U8(arr) => simd::find_u8(&arr[start..end], b'\n'),
+            U32(arr) => simd::find_u32(&arr[start..end], '\n' as u32),
+        }.map(|pos| start + pos)
+    }
+
     pub fn get_u32(&self, i: usize) -> u32 {
         match self {
             U8(arr) => arr[i] as u32,
@@ -51,42 +83,57 @@ impl GlkArray<'_> {
         match (src, self) {
             (U8(src), U8(dest)) => dest[dest_start..dest_end].copy_from_slice(&src[src_start..src_end]),
             (U32(src), U32(dest)) => dest[dest_start..dest_end].copy_from_slice(&src[src_start..src_end]),
-            (U8(src), U32(dest)) => {
-                for (i, &ch) in src[src_start..src_end].iter().enumerate() {
-                    dest[dest_start + i] = ch as u32;
-                }
-            },
+            (U8(src), U32(dest)) => simd::widen_latin1(&src[src_start..src_end], &mut dest[dest_start..dest_end]),
             // When a unicode array is read into a Latin-1 array we must catch non-latin1 characters
-            (U32(src), U8(dest)) => {
-                for (i, &ch) in src[src_start..src_end].iter().enumerate() {
-                    dest[dest_start + i] = if ch > MAX_LATIN1 {QUESTION_MARK} else {ch} as u8;
-                }
-            },
+            (U32(src), U8(dest)) => simd::narrow_latin1(&src[src_start..src_end], &mut dest[dest_start..dest_end]),
         }
     }
 
-    pub fn set_str(&mut self, start: usize, str: &str) -> (usize, usize) {
-        let chars: Vec<char> = str.chars().collect();
-        let str_length = chars.len();
-        let write_length = min(str_length, self.len() - start);
+    /** Copy Latin-1 bytes into this array */
+    pub fn set_latin1(&mut self, start: usize, src: &[u8]) {
+        let end = start + src.len();
         match self {
-            U8(arr) => {
-                for (i, &ch) in chars[..write_length].iter().enumerate() {
-                    arr[start + i] = if ch as u32 > MAX_LATIN1 {QUESTION_MARK} else {ch as u32} as u8;
-                }
-            },
-            U32(arr) => {
-                for (i, &ch) in chars[..write_length].iter().enumerate() {
-                    arr[start + i] = ch as u32;
+            U8(arr) => arr[start..end].copy_from_slice(src),
+            U32(arr) => simd::widen_latin1(src, &mut arr[start..end]),
+        }
+    }
+
+    /** Write a string into this array, returning the string length and the number of characters actually written
+     *
+     * This walks the UTF-8 bytes directly: ASCII runs are copied in bulk, and only multibyte sequences are decoded.
+     */
+    pub fn set_str(&mut self, start: usize, str: &str) -> (usize, usize) {
+        let bytes = str.as_bytes();
+        let len = self.len();
+        let mut i = 0;
+        let mut written = 0;
+        while i < bytes.len() && start + written < len {
+            let space = len - start - written;
+            let run = ascii_run_length(&bytes[i..min(bytes.len(), i + space)]);
+            if run > 0 {
+                let dest_start = start + written;
+                match self {
+                    U8(arr) => arr[dest_start..dest_start + run].copy_from_slice(&bytes[i..i + run]),
+                    U32(arr) => simd::widen_latin1(&bytes[i..i + run], &mut arr[dest_start..dest_start + run]),
                 }
+                i += run;
+                written += run;
+                continue;
             }
+            // `i` is always on a char boundary here, and the next char is not ASCII
+            let ch = str[i..].chars().next().unwrap();
+            self.set_u32(start + written, ch as u32);
+            i += ch.len_utf8();
+            written += 1;
         }
-        (str_length, write_length)
+        // Count whatever didn't fit, without having to decode it
+        let remaining = bytes[i..].iter().filter(|&&b| (b as i8) >= -0x40).count();
+        (written + remaining, written)
     }
 
     pub fn set_u32(&mut self, index: usize, ch: u32) {
         match self {
-            U8(arr) => arr[index] = if ch > MAX_LATIN1 {QUESTION_MARK} else {ch} as u8,
+            U8(arr) => arr[index] = u8::from_u32(ch),
             U32(arr) => arr[index] = ch,
         };
     }
@@ -99,6 +146,59 @@ impl GlkArray<'_> {
     }
 }
 
+/** An element of a Glk array: a Latin-1 byte or a Unicode character
+ *
+ * Streams which are generic over their element type get the Latin-1 clamp decided at compile time.
+ */
+pub trait GlkElement: Copy + Default {
+    /** Whether this element can hold any Unicode character */
+    const UNI: bool;
+    fn as_array(arr: &mut [Self]) -> GlkArray<'_>;
+    fn from_u32(ch: u32) -> Self;
+    fn to_u32(self) -> u32;
+}
+
+impl GlkElement for u8 {
+    const UNI: bool = false;
+
+    fn as_array(arr: &mut [Self]) -> GlkArray<'_> {
+        U8(arr)
+    }
+
+    #[inline(always)]
+    fn from_u32(ch: u32) -> Self {
+        (if ch > MAX_LATIN1 {QUESTION_MARK} else {ch}) as u8
+    }
+
+    #[inline(always)]
+    fn to_u32(self) -> u32 {
+        self as u32
+    }
+}
+
+impl GlkElement for u32 {
+    const UNI: bool = true;
+
+    fn as_array(arr: &mut [Self]) -> GlkArray<'_> {
+        U32(arr)
+    }
+
+    #[inline(always)]
+    fn from_u32(ch: u32) -> Self {
+        ch
+    }
+
+    #[inline(always)]
+    fn to_u32(self) -> u32 {
+        self
+    }
+}
+
+/** Length of the run of ASCII bytes at the start of a slice */
+fn ascii_run_length(bytes: &[u8]) -> usize {
+    bytes.iter().position(|&b| b >= 0x80).unwrap_or(bytes.len())
+}
+
 /** Final read/write character counts of a stream */
 pub struct StreamResult {
     pub read_count: u32,
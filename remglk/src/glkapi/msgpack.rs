@@ -0,0 +1,442 @@
+/*
+
+MessagePack encoding
+====================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::borrow::Cow;
+use std::io::{self, Write};
+
+use super::deserialise::*;
+use super::protocol::Event;
+use super::serialise::*;
+
+/** Parse one input event from a MessagePack message */
+pub fn parse_event(data: &[u8]) -> Result<Event<'_>> {
+    let mut reader = MessagePackReader::new(data);
+    let event = deserialise_event(&mut reader)?;
+    reader.finish()?;
+    Ok(event)
+}
+
+/** An array or map which has been started but not finished */
+struct OpenContainer {
+    count: u32,
+    /** Where the 32 bit length needs to be written */
+    header: usize,
+    map: bool,
+}
+
+/** A streaming MessagePack writer, which writes into a reusable output buffer
+ *
+ * The Serialiser doesn't know how many items an array or object will have, so space for an array32 or map32 header is reserved, and the length written in when it's finished.
+ */
+#[derive(Default)]
+pub struct MessagePackWriter {
+    buf: Vec<u8>,
+    stack: Vec<OpenContainer>,
+}
+
+impl MessagePackWriter {
+    pub fn new() -> Self {
+        MessagePackWriter::default()
+    }
+
+    pub fn as_bytes(&self) -> &[u8] {
+        &self.buf
+    }
+
+    /** Empty the output buffer, keeping its capacity */
+    pub fn clear(&mut self) {
+        self.buf.clear();
+        self.stack.clear();
+    }
+
+    pub fn into_inner(self) -> Vec<u8> {
+        self.buf
+    }
+
+    /** Serialise a value, replacing whatever was in the buffer */
+    pub fn write<T: Serialise + ?Sized>(&mut self, val: &T) -> &[u8] {
+        self.clear();
+        val.serialise(self);
+        &self.buf
+    }
+
+    /** Write the buffer out as a length prefixed frame */
+    pub fn write_to<W: Write>(&self, output: &mut W) -> io::Result<()> {
+        output.write_all(&(self.buf.len() as u32).to_le_bytes())?;
+        output.write_all(&self.buf)?;
+        output.flush()
+    }
+
+    /** Count a new array element. Map entries are counted by their keys */
+    fn element(&mut self) {
+        if let Some(container) = self.stack.last_mut() {
+            if !container.map {
+                container.count += 1;
+            }
+        }
+    }
+
+    fn begin(&mut self, marker: u8, map: bool) {
+        self.element();
+        self.buf.push(marker);
+        self.stack.push(OpenContainer {
+            count: 0,
+            header: self.buf.len(),
+            map,
+        });
+        self.buf.extend_from_slice(&[0; 4]);
+    }
+
+    /** Fill in the container's length, shrinking the header when it fits a smaller form
+     *
+     * The shrinking moves the container's contents down, but protocol messages are shallow so each byte is only moved a few times.
+     */
+    fn end(&mut self) {
+        let OpenContainer {count, header, map} = self.stack.pop().expect("Unbalanced end of array or object");
+        if count < 16 {
+            self.buf[header - 1] = (if map {0x80} else {0x90}) | count as u8;
+            self.buf.drain(header..header + 4);
+        }
+        else if count <= 0xFFFF {
+            self.buf[header - 1] = if map {0xDE} else {0xDC};
+            self.buf[header..header + 2].copy_from_slice(&(count as u16).to_be_bytes());
+            self.buf.drain(header + 2..header + 4);
+        }
+        else {
+            self.buf[header..header + 4].copy_from_slice(&count.to_be_bytes());
+        }
+    }
+
+    fn write_str(&mut self, val: &str) {
+        let len = val.len();
+        self.buf.reserve(len + 5);
+        if len < 32 {
+            self.buf.push(0xA0 | len as u8);
+        }
+        else if len <= 0xFF {
+            self.buf.extend_from_slice(&[0xD9, len as u8]);
+        }
+        else if len <= 0xFFFF {
+            self.buf.push(0xDA);
+            self.buf.extend_from_slice(&(len as u16).to_be_bytes());
+        }
+        else {
+            self.buf.push(0xDB);
+            self.buf.extend_from_slice(&(len as u32).to_be_bytes());
+        }
+        self.buf.extend_from_slice(val.as_bytes());
+    }
+
+    fn write_u32(&mut self, val: u32) {
+        if val < 0x80 {
+            self.buf.push(val as u8);
+        }
+        else if val <= 0xFF {
+            self.buf.extend_from_slice(&[0xCC, val as u8]);
+        }
+        else if val <= 0xFFFF {
+            self.buf.push(0xCD);
+            self.buf.extend_from_slice(&(val as u16).to_be_bytes());
+        }
+        else {
+            self.buf.push(0xCE);
+            self.buf.extend_from_slice(&val.to_be_bytes());
+        }
+    }
+}
+
+impl Serialiser for MessagePackWriter {
+    fn begin_array(&mut self) {
+        self.begin(0xDD, false);
+    }
+
+    fn begin_object(&mut self) {
+        self.begin(0xDF, true);
+    }
+
+    fn bool(&mut self, val: bool) {
+        self.element();
+        self.buf.push(if val {0xC3} else {0xC2});
+    }
+
+    fn end_array(&mut self) {
+        self.end();
+    }
+
+    fn end_object(&mut self) {
+        self.end();
+    }
+
+    fn f64(&mut self, val: f64) {
+        if !val.is_finite() {
+            return self.null();
+        }
+        self.element();
+        // Whole numbers (the common case for metrics) are written as integers
+        if val.fract() == 0.0 && (0.0..4294967296.0).contains(&val) {
+            self.write_u32(val as u32);
+        }
+        else {
+            self.buf.push(0xCB);
+            self.buf.extend_from_slice(&val.to_be_bytes());
+        }
+    }
+
+    fn key(&mut self, key: &str) {
+        if let Some(container) = self.stack.last_mut() {
+            container.count += 1;
+        }
+        self.write_str(key);
+    }
+
+    fn null(&mut self) {
+        self.element();
+        self.buf.push(0xC0);
+    }
+
+    fn str(&mut self, val: &str) {
+        self.element();
+        self.write_str(val);
+    }
+
+    fn u32(&mut self, val: u32) {
+        self.element();
+        self.write_u32(val);
+    }
+}
+
+/** A MessagePack pull parser which borrows strings from its input */
+pub struct MessagePackReader<'a> {
+    input: &'a [u8],
+    pos: usize,
+    /** The number of items left in each open array or map */
+    remaining: Vec<u32>,
+}
+
+impl<'a> MessagePackReader<'a> {
+    pub fn new(input: &'a [u8]) -> Self {
+        MessagePackReader {
+            input,
+            pos: 0,
+            remaining: Vec::new(),
+        }
+    }
+
+    /** Check there's nothing after the value */
+    pub fn finish(&mut self) -> Result<()> {
+        if self.pos < self.input.len() {
+            return Err(self.error("Unexpected data after MessagePack value"));
+        }
+        Ok(())
+    }
+
+    /** The current byte offset into the input */
+    pub fn position(&self) -> usize {
+        self.pos
+    }
+
+    fn bytes(&mut self, len: usize) -> Result<&'a [u8]> {
+        let bytes = self.input.get(self.pos..self.pos + len).ok_or_else(|| self.error("Unexpected end of message"))?;
+        self.pos += len;
+        Ok(bytes)
+    }
+
+    fn byte(&mut self) -> Result<u8> {
+        Ok(self.bytes(1)?[0])
+    }
+
+    fn be_u16(&mut self) -> Result<u16> {
+        Ok(u16::from_be_bytes(self.bytes(2)?.try_into().unwrap()))
+    }
+
+    fn be_u32(&mut self) -> Result<u32> {
+        Ok(u32::from_be_bytes(self.bytes(4)?.try_into().unwrap()))
+    }
+
+    fn be_u64(&mut self) -> Result<u64> {
+        Ok(u64::from_be_bytes(self.bytes(8)?.try_into().unwrap()))
+    }
+
+    fn peek_byte(&self) -> Result<u8> {
+        self.input.get(self.pos).copied().ok_or_else(|| self.error("Unexpected end of message"))
+    }
+
+    /** Read a container header, returning its length */
+    fn container(&mut self, fix: u8, len16: u8, len32: u8, reason: &'static str) -> Result<u32> {
+        let marker = self.byte()?;
+        let len = match marker {
+            _ if marker & 0xF0 == fix => (marker & 0x0F) as u32,
+            _ if marker == len16 => self.be_u16()? as u32,
+            _ if marker == len32 => self.be_u32()?,
+            _ => {
+                self.pos -= 1;
+                return Err(self.error(reason));
+            },
+        };
+        if self.remaining.len() == MAX_DEPTH {
+            return Err(self.error("Too deeply nested"));
+        }
+        self.remaining.push(len);
+        Ok(len)
+    }
+
+    /** Move on to the next item of the current container */
+    fn next_item(&mut self) -> bool {
+        match self.remaining.last_mut() {
+            Some(0) => {
+                self.remaining.pop();
+                false
+            },
+            Some(remaining) => {
+                *remaining -= 1;
+                true
+            },
+            None => false,
+        }
+    }
+
+    /** Read any number */
+    fn number(&mut self) -> Result<f64> {
+        let marker = self.byte()?;
+        Ok(match marker {
+            0x00..=0x7F => marker as f64,
+            0xE0..=0xFF => marker as i8 as f64,
+            0xCA => f32::from_bits(self.be_u32()?) as f64,
+            0xCB => f64::from_bits(self.be_u64()?),
+            0xCC => self.byte()? as f64,
+            0xCD => self.be_u16()? as f64,
+            0xCE => self.be_u32()? as f64,
+            0xCF => self.be_u64()? as f64,
+            0xD0 => self.byte()? as i8 as f64,
+            0xD1 => self.be_u16()? as i16 as f64,
+            0xD2 => self.be_u32()? as i32 as f64,
+            0xD3 => self.be_u64()? as i64 as f64,
+            _ => {
+                self.pos -= 1;
+                return Err(self.error("Expected a number"));
+            },
+        })
+    }
+}
+
+impl<'a> Deserialiser<'a> for MessagePackReader<'a> {
+    fn begin_array(&mut self) -> Result<()> {
+        self.container(0x90, 0xDC, 0xDD, "Expected an array")?;
+        Ok(())
+    }
+
+    fn begin_object(&mut self) -> Result<()> {
+        self.container(0x80, 0xDE, 0xDF, "Expected an object")?;
+        Ok(())
+    }
+
+    fn bool(&mut self) -> Result<bool> {
+        match self.peek_byte()? {
+            0xC2 => {self.pos += 1; Ok(false)},
+            0xC3 => {self.pos += 1; Ok(true)},
+            _ => Err(self.error("Expected a boolean")),
+        }
+    }
+
+    fn error(&self, reason: &'static str) -> DeserialiseError {
+        DeserialiseError {
+            offset: self.pos,
+            reason,
+        }
+    }
+
+    fn f64(&mut self) -> Result<f64> {
+        self.number()
+    }
+
+    fn next_element(&mut self) -> Result<bool> {
+        Ok(self.next_item())
+    }
+
+    fn next_key(&mut self) -> Result<Option<Cow<'a, str>>> {
+        if !self.next_item() {
+            return Ok(None);
+        }
+        self.str().map(Some)
+    }
+
+    fn null(&mut self) -> Result<()> {
+        if self.peek_byte()? != 0xC0 {
+            return Err(self.error("Expected null"));
+        }
+        self.pos += 1;
+        Ok(())
+    }
+
+    fn peek(&mut self) -> Result<ValueKind> {
+        Ok(match self.peek_byte()? {
+            0x80..=0x8F | 0xDE | 0xDF => ValueKind::Object,
+            0x90..=0x9F | 0xDC | 0xDD => ValueKind::Array,
+            0xA0..=0xBF | 0xD9..=0xDB => ValueKind::String,
+            0xC0 => ValueKind::Null,
+            0xC2 | 0xC3 => ValueKind::Bool,
+            0x00..=0x7F | 0xE0..=0xFF | 0xCA..=0xD3 => ValueKind::Number,
+            _ => return Err(self.error("Unsupported MessagePack type")),
+        })
+    }
+
+    fn str(&mut self) -> Result<Cow<'a, str>> {
+        let marker = self.byte()?;
+        let len = match marker {
+            0xA0..=0xBF => (marker & 0x1F) as usize,
+            0xD9 => self.byte()? as usize,
+            0xDA => self.be_u16()? as usize,
+            0xDB => self.be_u32()? as usize,
+            _ => {
+                self.pos -= 1;
+                return Err(self.error("Expected a string"));
+            },
+        };
+        let start = self.pos;
+        let bytes = self.bytes(len)?;
+        std::str::from_utf8(bytes).map(Cow::Borrowed).map_err(|_| DeserialiseError {
+            offset: start,
+            reason: "Invalid UTF-8 in string",
+        })
+    }
+
+    fn u32(&mut self) -> Result<u32> {
+        let marker = self.peek_byte()?;
+        match marker {
+            0x00..=0x7F => {
+                self.pos += 1;
+                return Ok(marker as u32);
+            },
+            0xCC => {
+                self.pos += 1;
+                return Ok(self.byte()? as u32);
+            },
+            0xCD => {
+                self.pos += 1;
+                return Ok(self.be_u16()? as u32);
+            },
+            0xCE => {
+                self.pos += 1;
+                return self.be_u32();
+            },
+            _ => {},
+        }
+        let start = self.pos;
+        let val = self.number()?;
+        if val < 0.0 || val > u32::MAX as f64 || val.fract() != 0.0 {
+            return Err(DeserialiseError {
+                offset: start,
+                reason: "Expected an unsigned integer",
+            });
+        }
+        Ok(val as u32)
+    }
+}
@@ -0,0 +1,79 @@
+/*
+
+Buffer pools
+============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::sync::{Arc, Mutex};
+
+/** The smallest size class holds 64 elements */
+const MIN_CLASS_SHIFT: u32 = 6;
+/** Buffers larger than 2^24 elements are not kept */
+const MAX_CLASS_SHIFT: u32 = 24;
+/** How many free buffers to keep in each size class */
+const MAX_FREE_PER_CLASS: usize = 16;
+
+/** A pool of reusable buffers, bucketed into power of two size classes */
+pub struct BufferPool<T> {
+    classes: Vec<Vec<Vec<T>>>,
+}
+
+pub type SharedBufferPool<T> = Arc<Mutex<BufferPool<T>>>;
+
+impl<T> BufferPool<T> {
+    pub fn new() -> Self {
+        BufferPool {
+            classes: (MIN_CLASS_SHIFT..=MAX_CLASS_SHIFT).map(|_| Vec::new()).collect(),
+        }
+    }
+
+    pub fn new_shared() -> SharedBufferPool<T> {
+        Arc::new(Mutex::new(BufferPool::new()))
+    }
+
+    /** Get an empty buffer with at least the requested capacity */
+    pub fn acquire(&mut self, min_capacity: usize) -> Vec<T> {
+        let shift = class_shift(min_capacity);
+        if shift <= MAX_CLASS_SHIFT {
+            if let Some(buf) = self.classes[(shift - MIN_CLASS_SHIFT) as usize].pop() {
+                return buf;
+            }
+        }
+        Vec::with_capacity(1 << shift)
+    }
+
+    /** Return a buffer to the pool */
+    pub fn release(&mut self, mut buf: Vec<T>) {
+        let capacity = buf.capacity();
+        if capacity < 1 << MIN_CLASS_SHIFT {
+            return;
+        }
+        // Round down, so that every buffer in a class can hold the class size
+        let shift = usize::BITS - 1 - capacity.leading_zeros();
+        if shift > MAX_CLASS_SHIFT {
+            return;
+        }
+        let class = &mut self.classes[(shift - MIN_CLASS_SHIFT) as usize];
+        if class.len() < MAX_FREE_PER_CLASS {
+            buf.clear();
+            class.push(buf);
+        }
+    }
+}
+
+impl<T> Default for BufferPool<T> {
+    fn default() -> Self {
+        BufferPool::new()
+    }
+}
+
+/** The size class for a requested capacity, rounding up */
+fn class_shift(capacity: usize) -> u32 {
+    let shift = usize::BITS - capacity.saturating_sub(1).leading_zeros();
+    shift.max(MIN_CLASS_SHIFT)
+}
@@ -9,44 +9,50 @@ https://github.com/curiousdannii/remglk-rs
 
 */
 
+use std::borrow::Cow;
 use std::collections::HashMap;
 
+use super::atoms::Atom;
+
 /** The GlkOte protocol has two parts:
  * 1. GlkOte sends events to GlkApi/RemGlk
  * 2. GlkApi/RemGlk send content updates to GlkOte
 */
 
-/** GlkOte->GlkApi/RemGlk input events */
-pub enum Event {
-    ArrangeEvent,
-    CharEvent,
-    DebugEvent,
-    ExternalEvent,
-    HyperlinkEvent,
-    InitEvent,
-    LineEvent,
-    MouseEvent,
-    RedrawEvent,
-    RefreshEvent,
-    SpecialEvent,
-    TimerEvent,
-}
-
-pub struct EventBase {
+/** GlkOte->GlkApi/RemGlk input events
+ *
+ * Strings are borrowed from the input where possible
+ */
+pub enum Event<'a> {
+    ArrangeEvent(ArrangeEvent<'a>),
+    CharEvent(CharEvent<'a>),
+    DebugEvent(DebugEvent<'a>),
+    ExternalEvent(ExternalEvent<'a>),
+    HyperlinkEvent(HyperlinkEvent<'a>),
+    InitEvent(InitEvent<'a>),
+    LineEvent(LineEvent<'a>),
+    MouseEvent(MouseEvent<'a>),
+    RedrawEvent(RedrawEvent<'a>),
+    RefreshEvent(RefreshEvent<'a>),
+    SpecialEvent(SpecialEvent<'a>),
+    TimerEvent(TimerEvent<'a>),
+}
+
+pub struct EventBase<'a> {
     /** Generation number */
     pub gen: u32,
     /** Partial line input values */
-    pub partial: Option<HashMap<u32, String>>,
+    pub partial: Option<HashMap<u32, Cow<'a, str>>>,
 }
 
-pub struct ArrangeEvent {
-    pub base: EventBase,
+pub struct ArrangeEvent<'a> {
+    pub base: EventBase<'a>,
     pub metrics: Metrics,
 }
 
 /** Character (single key) event */
-pub struct CharEvent {
-    pub base: EventBase,
+pub struct CharEvent<'a> {
+    pub base: EventBase<'a>,
     /** Character that was received */
     pub value: CharEventData,
     /** Window ID */
@@ -54,48 +60,48 @@ pub struct CharEvent {
 }
 pub enum CharEventData {
     NormalKey(char),
-    SpecialKeyCode,
+    SpecialKeyCode(SpecialKeyCode),
 }
 
-pub struct DebugEvent {
-    pub base: EventBase,
-    pub value: String,
+pub struct DebugEvent<'a> {
+    pub base: EventBase<'a>,
+    pub value: Cow<'a, str>,
 }
 
-pub struct ExternalEvent {
-    pub base: EventBase,
+pub struct ExternalEvent<'a> {
+    pub base: EventBase<'a>,
     // TODO?
     //value: any,
 }
 
-pub struct HyperlinkEvent {
-    pub base: EventBase,
+pub struct HyperlinkEvent<'a> {
+    pub base: EventBase<'a>,
     pub value: u32,
     /** Window ID */
     pub window: u32,
 }
 
 /** Initilisation event */
-pub struct InitEvent {
-    pub base: EventBase,
+pub struct InitEvent<'a> {
+    pub base: EventBase<'a>,
     pub metrics: Metrics,
     /** Capabilities list */
-    pub support: Vec<String>,
+    pub support: Vec<Cow<'a, str>>,
 }
 
 /** Line (text) event */
-pub struct LineEvent {
-    pub base: EventBase,
+pub struct LineEvent<'a> {
+    pub base: EventBase<'a>,
     /** Terminator key */
     pub terminator: Option<TerminatorCode>,
     /** Line input */
-    pub value: String,
+    pub value: Cow<'a, str>,
     /** Window ID */
     pub window: u32,
 }
 
-pub struct MouseEvent {
-    pub base: EventBase,
+pub struct MouseEvent<'a> {
+    pub base: EventBase<'a>,
     /** Window ID */
     pub window: u32,
     /** Mouse click X */
@@ -104,36 +110,157 @@ pub struct MouseEvent {
     pub y: u32,
 }
 
-pub struct RedrawEvent {
-    pub base: EventBase,
+pub struct RedrawEvent<'a> {
+    pub base: EventBase<'a>,
     /** Window ID */
     pub window: Option<u32>,
 }
 
-pub struct RefreshEvent {
-    pub base: EventBase,
+pub struct RefreshEvent<'a> {
+    pub base: EventBase<'a>,
 }
 
-pub struct SpecialEvent {
-    pub base: EventBase,
+pub struct SpecialEvent<'a> {
+    pub base: EventBase<'a>,
     /** Event value (file reference from Dialog) */
-    pub value: Option<FileRef>,
+    pub value: Option<FileRef<'a>>,
 }
 
-pub struct FileRef {
-    pub content: Option<String>,
-    pub dirent: Option<String>,
-    pub filename: String,
-    pub gameid: Option<String>,
+pub struct FileRef<'a> {
+    pub content: Option<Cow<'a, str>>,
+    pub dirent: Option<Cow<'a, str>>,
+    pub filename: Cow<'a, str>,
+    pub gameid: Option<Cow<'a, str>>,
     // TODO: do we need null here?
-    pub usage: Option<String>,
-}
-
-pub struct TimerEvent {
-    pub base: EventBase,
+    pub usage: Option<Cow<'a, str>>,
+}
+
+pub struct TimerEvent<'a> {
+    pub base: EventBase<'a>,
+}
+
+fn owned<'a>(str: Cow<'_, str>) -> Cow<'a, str> {
+    Cow::Owned(str.into_owned())
+}
+
+impl<'a> Event<'a> {
+    /** Copy any borrowed strings, so the event can outlive its input */
+    pub fn into_owned(self) -> Event<'static> {
+        use Event::*;
+        match self {
+            ArrangeEvent(event) => ArrangeEvent(self::ArrangeEvent {
+                base: event.base.into_owned(),
+                metrics: event.metrics,
+            }),
+            CharEvent(event) => CharEvent(self::CharEvent {
+                base: event.base.into_owned(),
+                value: event.value,
+                window: event.window,
+            }),
+            DebugEvent(event) => DebugEvent(self::DebugEvent {
+                base: event.base.into_owned(),
+                value: owned(event.value),
+            }),
+            ExternalEvent(event) => ExternalEvent(self::ExternalEvent {
+                base: event.base.into_owned(),
+            }),
+            HyperlinkEvent(event) => HyperlinkEvent(self::HyperlinkEvent {
+                base: event.base.into_owned(),
+                value: event.value,
+                window: event.window,
+            }),
+            InitEvent(event) => InitEvent(self::InitEvent {
+                base: event.base.into_owned(),
+                metrics: event.metrics,
+                support: event.support.into_iter().map(owned).collect(),
+            }),
+            LineEvent(event) => LineEvent(self::LineEvent {
+                base: event.base.into_owned(),
+                terminator: event.terminator,
+                value: owned(event.value),
+                window: event.window,
+            }),
+            MouseEvent(event) => MouseEvent(self::MouseEvent {
+                base: event.base.into_owned(),
+                window: event.window,
+                x: event.x,
+                y: event.y,
+            }),
+            RedrawEvent(event) => RedrawEvent(self::RedrawEvent {
+                base: event.base.into_owned(),
+                window: event.window,
+            }),
+            RefreshEvent(event) => RefreshEvent(self::RefreshEvent {
+                base: event.base.into_owned(),
+            }),
+            SpecialEvent(event) => SpecialEvent(self::SpecialEvent {
+                base: event.base.into_owned(),
+                value: event.value.map(FileRef::into_owned),
+            }),
+            TimerEvent(event) => TimerEvent(self::TimerEvent {
+                base: event.base.into_owned(),
+            }),
+        }
+    }
+
+    pub fn base(&self) -> &EventBase<'a> {
+        match self {
+            Event::ArrangeEvent(event) => &event.base,
+            Event::CharEvent(event) => &event.base,
+            Event::DebugEvent(event) => &event.base,
+            Event::ExternalEvent(event) => &event.base,
+            Event::HyperlinkEvent(event) => &event.base,
+            Event::InitEvent(event) => &event.base,
+            Event::LineEvent(event) => &event.base,
+            Event::MouseEvent(event) => &event.base,
+            Event::RedrawEvent(event) => &event.base,
+            Event::RefreshEvent(event) => &event.base,
+            Event::SpecialEvent(event) => &event.base,
+            Event::TimerEvent(event) => &event.base,
+        }
+    }
+
+    pub fn base_mut(&mut self) -> &mut EventBase<'a> {
+        match self {
+            Event::ArrangeEvent(event) => &mut event.base,
+            Event::CharEvent(event) => &mut event.base,
+            Event::DebugEvent(event) => &mut event.base,
+            Event::ExternalEvent(event) => &mut event.base,
+            Event::HyperlinkEvent(event) => &mut event.base,
+            Event::InitEvent(event) => &mut event.base,
+            Event::LineEvent(event) => &mut event.base,
+            Event::MouseEvent(event) => &mut event.base,
+            Event::RedrawEvent(event) => &mut event.base,
+            Event::RefreshEvent(event) => &mut event.base,
+            Event::SpecialEvent(event) => &mut event.base,
+            Event::TimerEvent(event) => &mut event.base,
+        }
+    }
+}
+
+impl EventBase<'_> {
+    pub fn into_owned(self) -> EventBase<'static> {
+        EventBase {
+            gen: self.gen,
+            partial: self.partial.map(|partial| partial.into_iter().map(|(window, text)| (window, owned(text))).collect()),
+        }
+    }
+}
+
+impl FileRef<'_> {
+    pub fn into_owned(self) -> FileRef<'static> {
+        FileRef {
+            content: self.content.map(owned),
+            dirent: self.dirent.map(owned),
+            filename: owned(self.filename),
+            gameid: self.gameid.map(owned),
+            usage: self.usage.map(owned),
+        }
+    }
 }
 
 /** Screen and font metrics - all potential options */
+#[derive(Default)]
 pub struct Metrics {
     /** Buffer character height */
     pub buffercharheight: Option<f64>,
@@ -194,6 +321,7 @@ pub struct Metrics {
 }
 
 /** Normalised screen and font metrics */
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
 pub struct NormalisedMetrics {
     /** Buffer character height */
     pub buffercharheight: f64,
@@ -229,16 +357,16 @@ pub struct NormalisedMetrics {
 
 /** GlkApi/RemGlk->GlkOte content updates */
 pub enum Update<A> {
-    ErrorUpdate,
-    ExitUpdate,
-    PassUpdate,
-    RetryUpdate,
+    ErrorUpdate(ErrorUpdate),
+    ExitUpdate(ExitUpdate),
+    PassUpdate(PassUpdate),
+    RetryUpdate(RetryUpdate),
     StateUpdate(StateUpdate<A>),
 }
 
 pub struct ErrorUpdate {
     /** Error message */
-    pub message: str,
+    pub message: String,
 }
 
 pub struct ExitUpdate {}
@@ -273,9 +401,9 @@ pub struct StateUpdate<A> {
 
 /** Content update */
 pub enum ContentUpdate {
-    BufferWindowContentUpdate,
-    GraphicsWindowContentUpdate,
-    GridWindowContentUpdate,
+    BufferWindowContentUpdate(BufferWindowContentUpdate),
+    GraphicsWindowContentUpdate(GraphicsWindowContentUpdate),
+    GridWindowContentUpdate(GridWindowContentUpdate),
 }
 
 pub struct TextualWindowUpdate {
@@ -316,9 +444,9 @@ pub struct GraphicsWindowContentUpdate {
 
 /** Graphics window operation */
 pub enum GraphicsWindowOperation {
-    FillOperation,
-    ImageOperation,
-    SetcolorOperation,
+    FillOperation(FillOperation),
+    ImageOperation(ImageOperation),
+    SetcolorOperation(SetcolorOperation),
 }
 
 /** Fill operation */
@@ -350,7 +478,7 @@ pub struct ImageOperation {
 /** Setcolor operation */
 pub struct SetcolorOperation {
     /** CSS color */
-    pub color: str,
+    pub color: String,
 }
 
 /** Grid window content update */
@@ -366,9 +494,9 @@ pub struct GridWindowLine {
 
 /** Line data */
 pub enum LineData {
-    StylePair(String, String),
-    BufferWindowImage,
-    TextRun,
+    StylePair(Style, String),
+    BufferWindowImage(BufferWindowImage),
+    TextRun(TextRun),
 }
 
 /** Buffer window image */
@@ -394,12 +522,13 @@ pub struct TextRun {
     /** Hyperlink value */
     pub hyperlink: Option<u32>,
     /** Run style */
-    pub style: String,
+    pub style: Style,
     /** Run content */
     pub text: String,
 }
 
 /** Windows with active input */
+#[derive(Clone, Debug, PartialEq)]
 pub struct InputUpdate {
     /** Generation number, for when the textual input was first requested */
     pub gen: Option<u32>,
@@ -433,6 +562,7 @@ pub struct SpecialInput {
 }
 
 /** Updates to window (new windows, or changes to their arrangements) */
+#[derive(Clone, Debug, PartialEq)]
 pub struct WindowUpdate {
     /** Graphics height (pixels) */
     pub graphheight: Option<u32>,
@@ -465,7 +595,8 @@ pub struct WindowUpdate {
  * - `reverse`: enables reverse mode. If you provide colours then do not pre-reverse them.
  *   Ex: `background-color: #FFF, color: #000, reverse: 1` will be displayed as white text on a black background
  */
-pub type CSSProperties = HashMap<String, CSSValue>;
+pub type CSSProperties = HashMap<Atom, CSSValue>;
+#[derive(Clone, Debug, PartialEq)]
 pub enum CSSValue {
     String(String),
     Number(f64),
@@ -475,12 +606,43 @@ pub enum CSSValue {
  * Keys will usually be for Glk styles, ex: `div.Style_header` or `span.Style_user1`
  * But they can be anything else. Use a blank string to target the window itself.
 */
-pub type WindowStyles = HashMap<String, CSSProperties>;
-
-pub enum BufferWindowImageAlignment {InlineCenter,InlineDown, InlineUp, MarginLeft, MarginRight}
-pub enum FileMode {Read, ReadWrite, Write, WriteAppend}
-pub enum FileType {Command, Data, Save, Transcript}
-pub enum SpecialKeyCode {Delete, Down, End, Escape, Func1, Func2, Func3, Func4, Func5, Func6, Func7, Func8, Func9, Func10, Func11, Func12, Home, Left, Pagedown, Pageup, Return, Right, Tab, Up}
-pub enum TerminatorCode {Escape, Func1, Func2, Func3, Func4, Func5, Func6, Func7, Func8, Func9, Func10, Func11, Func12}
-pub enum TextInputType {Char, Line}
-pub enum WindowType {Buffer, Graphics, Grid}
\ No newline at end of file
+pub type WindowStyles = HashMap<Atom, CSSProperties>;
+
+/** An enum which is represented by strings in the protocol */
+macro_rules! string_enum {
+    ($name:ident {$($variant:ident = $str:literal),* $(,)?}) => {
+        #[derive(Clone, Copy, Debug, Eq, Hash, PartialEq)]
+        pub enum $name {$($variant),*}
+
+        impl $name {
+            pub fn from_name(name: &str) -> Option<Self> {
+                match name {
+                    $($str => Some($name::$variant),)*
+                    _ => None,
+                }
+            }
+
+            pub fn name(&self) -> &'static str {
+                match self {
+                    $($name::$variant => $str,)*
+                }
+            }
+        }
+    };
+}
+
+string_enum!(BufferWindowImageAlignment {InlineCenter = "inlinecenter", InlineDown = "inlinedown", InlineUp = "inlineup", MarginLeft = "marginleft", MarginRight = "marginright"});
+string_enum!(FileMode {Read = "read", ReadWrite = "readwrite", Write = "write", WriteAppend = "writeappend"});
+string_enum!(FileType {Command = "command", Data = "data", Save = "save", Transcript = "transcript"});
+string_enum!(SpecialKeyCode {Delete = "delete", Down = "down", End = "end", Escape = "escape", Func1 = "func1", Func2 = "func2", Func3 = "func3", Func4 = "func4", Func5 = "func5", Func6 = "func6", Func7 = "func7", Func8 = "func8", Func9 = "func9", Func10 = "func10", Func11 = "func11", Func12 = "func12", Home = "home", Left = "left", Pagedown = "pagedown", Pageup = "pageup", Return = "return", Right = "right", Tab = "tab", Up = "up"});
+string_enum!(Style {Normal = "normal", Emphasized = "emphasized", Preformatted = "preformatted", Header = "header", Subheader = "subheader", Alert = "alert", Note = "note", BlockQuote = "blockquote", Input = "input", User1 = "user1", User2 = "user2"});
+string_enum!(TerminatorCode {Escape = "escape", Func1 = "func1", Func2 = "func2", Func3 = "func3", Func4 = "func4", Func5 = "func5", Func6 = "func6", Func7 = "func7", Func8 = "func8", Func9 = "func9", Func10 = "func10", Func11 = "func11", Func12 = "func12"});
+string_enum!(TextInputType {Char = "char", Line = "line"});
+string_enum!(WindowType {Buffer = "buffer", Graphics = "graphics", Grid = "grid"});
+impl Style {
+    /** Convert a Glk style number, which are in the same order */
+    pub fn from_glk(style: u32) -> Option<Self> {
+        use Style::*;
+        [Normal, Emphasized, Preformatted, Header, Subheader, Alert, Note, BlockQuote, Input, User1, User2].get(style as usize).copied()
+    }
+}
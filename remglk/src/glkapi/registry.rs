@@ -0,0 +1,165 @@
+/*
+
+Glk object registry
+===================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use super::file_streams::GlkFileRef;
+use super::streams::GlkStream;
+use super::windows::GlkWindow;
+
+/** IDs have the slot index (plus one, so that 0 is never an ID) in the low bits, and the slot's generation in the high bits */
+const INDEX_BITS: u32 = 20;
+const INDEX_MASK: u32 = (1 << INDEX_BITS) - 1;
+const GENERATION_MASK: u32 = (1 << (32 - INDEX_BITS)) - 1;
+const NO_SLOT: u32 = u32::MAX;
+
+/** A generational slab of Glk objects
+ *
+ * Objects are stored contiguously, so iterating over them walks one array. IDs index a table of slots which says where each object currently is, giving O(1) lookup. When an object is removed its slot's generation is bumped, so an old ID won't find whatever reuses the slot (until the generation wraps around, after 4096 reuses).
+ */
+pub struct Registry<T> {
+    /** The ID of each object in `values` */
+    ids: Vec<u32>,
+    /** The first vacant slot */
+    free: u32,
+    slots: Vec<Slot>,
+    values: Vec<T>,
+}
+
+struct Slot {
+    /** The object's index in `values` when occupied, or the next vacant slot */
+    dense: u32,
+    generation: u32,
+    occupied: bool,
+}
+
+impl<T> Default for Registry<T> {
+    fn default() -> Self {
+        Registry {
+            ids: Vec::new(),
+            free: NO_SLOT,
+            slots: Vec::new(),
+            values: Vec::new(),
+        }
+    }
+}
+
+impl<T> Registry<T> {
+    pub fn new() -> Self {
+        Registry::default()
+    }
+
+    pub fn contains(&self, id: u32) -> bool {
+        self.dense_index(id).is_some()
+    }
+
+    pub fn get(&self, id: u32) -> Option<&T> {
+        self.dense_index(id).map(|index| &self.values[index])
+    }
+
+    pub fn get_mut(&mut self, id: u32) -> Option<&mut T> {
+        self.dense_index(id).map(|index| &mut self.values[index])
+    }
+
+    /** Add an object, returning its new ID */
+    pub fn insert(&mut self, val: T) -> u32 {
+        let dense = self.values.len() as u32;
+        let index = if self.free != NO_SLOT {
+            let index = self.free;
+            let slot = &mut self.slots[index as usize];
+            self.free = slot.dense;
+            slot.dense = dense;
+            slot.occupied = true;
+            index
+        }
+        else {
+            let index = self.slots.len() as u32;
+            if index >= INDEX_MASK {
+                panic!("Too many Glk objects");
+            }
+            self.slots.push(Slot {
+                dense,
+                generation: 0,
+                occupied: true,
+            });
+            index
+        };
+        let id = self.slots[index as usize].generation << INDEX_BITS | (index + 1);
+        self.ids.push(id);
+        self.values.push(val);
+        id
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.values.is_empty()
+    }
+
+    pub fn iter(&self) -> impl Iterator<Item = (u32, &T)> {
+        self.ids.iter().copied().zip(self.values.iter())
+    }
+
+    pub fn iter_mut(&mut self) -> impl Iterator<Item = (u32, &mut T)> {
+        self.ids.iter().copied().zip(self.values.iter_mut())
+    }
+
+    pub fn len(&self) -> usize {
+        self.values.len()
+    }
+
+    /** The ID after `id`, or the first ID if `id` is 0, as for `glk_*_iterate`
+     *
+     * Removal keeps the other objects in order, so any object may be removed while iterating, as long as the current one's next is found before it is removed itself.
+     */
+    pub fn next(&self, id: u32) -> Option<u32> {
+        let next = if id == 0 {0} else {self.dense_index(id)? + 1};
+        self.ids.get(next).copied()
+    }
+
+    /** Remove an object, shifting the objects after it down so that iteration order is kept */
+    pub fn remove(&mut self, id: u32) -> Option<T> {
+        let dense = self.dense_index(id)?;
+        let index = (id & INDEX_MASK) - 1;
+        let val = self.values.remove(dense);
+        self.ids.remove(dense);
+        for &moved in &self.ids[dense..] {
+            self.slots[((moved & INDEX_MASK) - 1) as usize].dense -= 1;
+        }
+        let slot = &mut self.slots[index as usize];
+        slot.dense = self.free;
+        slot.generation = (slot.generation + 1) & GENERATION_MASK;
+        slot.occupied = false;
+        self.free = index;
+        Some(val)
+    }
+
+    fn dense_index(&self, id: u32) -> Option<usize> {
+        let index = (id & INDEX_MASK).checked_sub(1)?;
+        let slot = self.slots.get(index as usize)?;
+        if slot.occupied && slot.generation == id >> INDEX_BITS {
+            Some(slot.dense as usize)
+        }
+        else {
+            None
+        }
+    }
+}
+
+/** All of a session's Glk objects */
+#[derive(Default)]
+pub struct GlkObjects<'a> {
+    pub filerefs: Registry<GlkFileRef>,
+    pub streams: Registry<GlkStream<'a>>,
+    pub windows: Registry<GlkWindow>,
+}
+
+impl GlkObjects<'_> {
+    pub fn new() -> Self {
+        GlkObjects::default()
+    }
+}
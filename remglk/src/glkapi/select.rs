@@ -0,0 +1,141 @@
+/*
+
+Non-blocking event selection
+============================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::future::Future;
+use std::pin::Pin;
+use std::sync::{Arc, Mutex};
+use std::task::{Context, Poll, Waker};
+
+use super::events::EventQueue;
+use super::protocol::*;
+use super::timers::TimerWheel;
+
+/** Make a channel for feeding a session's events to `glk_select`
+ *
+ * The sender can be given to whatever reads the protocol (a thread, a reactor, or an async task), and to the timer wheel; the game then takes events from the receiver without needing a thread of its own blocked on input.
+ */
+pub fn channel() -> (EventSender, EventReceiver) {
+    let inner = Arc::new(Mutex::new(Inner {
+        gen: 0,
+        queue: EventQueue::new(),
+        timer: 0,
+        waker: None,
+    }));
+    (EventSender {inner: inner.clone()}, EventReceiver {inner})
+}
+
+struct Inner {
+    /** The gen for locally generated timer events */
+    gen: u32,
+    queue: EventQueue,
+    /** Bumped whenever the timer is changed, so that old timers know to stop */
+    timer: u64,
+    waker: Option<Waker>,
+}
+
+#[derive(Clone)]
+pub struct EventSender {
+    inner: Arc<Mutex<Inner>>,
+}
+
+impl EventSender {
+    pub fn send(&self, event: Event) {
+        let waker = {
+            let mut inner = self.inner.lock().unwrap();
+            inner.queue.push(event);
+            inner.waker.take()
+        };
+        if let Some(waker) = waker {
+            waker.wake();
+        }
+    }
+}
+
+pub struct EventReceiver {
+    inner: Arc<Mutex<Inner>>,
+}
+
+impl EventReceiver {
+    /** Take the next event of any kind without waiting, as for `glk_select` */
+    pub fn select(&self) -> Option<Event<'static>> {
+        self.inner.lock().unwrap().queue.pop()
+    }
+
+    /** Take the next event which `glk_select_poll` may return: an arrange, redraw or timer event */
+    pub fn poll(&self) -> Option<Event<'static>> {
+        self.inner.lock().unwrap().queue.pop_matching(|event| matches!(event, Event::ArrangeEvent(_) | Event::RedrawEvent(_) | Event::TimerEvent(_)))
+    }
+
+    /** Wait for the next event of any kind */
+    pub fn select_async(&self) -> Select<'_> {
+        Select {receiver: self}
+    }
+
+    /** Set the gen of the last update sent, for timer events made by `set_timer` */
+    pub fn set_gen(&self, gen: u32) {
+        self.inner.lock().unwrap().gen = gen;
+    }
+
+    /** Start, replace or stop the session's timer, as for `glk_request_timer_events` (and the `timer` field of a state update) */
+    pub fn set_timer(&self, wheel: &TimerWheel, interval: Option<u32>) {
+        let timer = {
+            let mut inner = self.inner.lock().unwrap();
+            inner.timer += 1;
+            inner.timer
+        };
+        if let Some(interval) = interval.filter(|&interval| interval > 0) {
+            let sender = EventSender {inner: self.inner.clone()};
+            wheel.schedule(interval, move || {
+                let gen = {
+                    let inner = sender.inner.lock().unwrap();
+                    if inner.timer != timer {
+                        return false;
+                    }
+                    inner.gen
+                };
+                sender.send(Event::TimerEvent(TimerEvent {
+                    base: EventBase {
+                        gen,
+                        partial: None,
+                    },
+                }));
+                true
+            });
+        }
+    }
+}
+
+impl Drop for EventReceiver {
+    fn drop(&mut self) {
+        // Stop any timer
+        self.inner.lock().unwrap().timer += 1;
+    }
+}
+
+/** A future for the next event */
+pub struct Select<'a> {
+    receiver: &'a EventReceiver,
+}
+
+impl Future for Select<'_> {
+    type Output = Event<'static>;
+
+    fn poll(self: Pin<&mut Self>, cx: &mut Context<'_>) -> Poll<Self::Output> {
+        let mut inner = self.receiver.inner.lock().unwrap();
+        match inner.queue.pop() {
+            Some(event) => Poll::Ready(event),
+            None => {
+                inner.waker = Some(cx.waker().clone());
+                Poll::Pending
+            },
+        }
+    }
+}
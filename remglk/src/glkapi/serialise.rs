@@ -0,0 +1,351 @@
+/*
+
+Protocol serialisation
+======================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::collections::HashMap;
+
+use super::atoms::Atom;
+use super::protocol::*;
+
+/** A streaming output format for the GlkOte protocol
+ *
+ * Values are written as they are visited, so no intermediate tree is ever built.
+ */
+pub trait Serialiser {
+    fn begin_array(&mut self);
+    fn begin_object(&mut self);
+    fn bool(&mut self, val: bool);
+    fn end_array(&mut self);
+    fn end_object(&mut self);
+    fn f64(&mut self, val: f64);
+    /** An object key; must be followed by exactly one value */
+    fn key(&mut self, key: &str);
+    fn null(&mut self);
+    fn str(&mut self, val: &str);
+    fn u32(&mut self, val: u32);
+}
+
+pub trait Serialise {
+    fn serialise<S: Serialiser>(&self, s: &mut S);
+}
+
+/** Write an object field */
+fn field<S: Serialiser, T: Serialise + ?Sized>(s: &mut S, key: &str, val: &T) {
+    s.key(key);
+    val.serialise(s);
+}
+
+/** Write an object field, unless it's `None` */
+fn opt_field<S: Serialiser, T: Serialise>(s: &mut S, key: &str, val: &Option<T>) {
+    if let Some(val) = val {
+        field(s, key, val);
+    }
+}
+
+impl Serialise for bool {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.bool(*self);
+    }
+}
+
+impl Serialise for f64 {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.f64(*self);
+    }
+}
+
+impl Serialise for str {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.str(self);
+    }
+}
+
+impl Serialise for String {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.str(self);
+    }
+}
+
+impl Serialise for u32 {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.u32(*self);
+    }
+}
+
+impl<T: Serialise> Serialise for Option<T> {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        match self {
+            Some(val) => val.serialise(s),
+            None => s.null(),
+        }
+    }
+}
+
+impl<T: Serialise> Serialise for Vec<T> {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_array();
+        for val in self {
+            val.serialise(s);
+        }
+        s.end_array();
+    }
+}
+
+impl<T: Serialise> Serialise for HashMap<Atom, T> {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        for (key, val) in self {
+            field(s, key.as_str(), val);
+        }
+        s.end_object();
+    }
+}
+
+// Updates
+
+impl<A: Serialise> Serialise for Update<A> {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        match self {
+            Update::ErrorUpdate(update) => update.serialise(s),
+            Update::ExitUpdate(_) => type_only(s, "exit"),
+            Update::PassUpdate(_) => type_only(s, "pass"),
+            Update::RetryUpdate(_) => type_only(s, "retry"),
+            Update::StateUpdate(update) => update.serialise(s),
+        }
+    }
+}
+
+fn type_only<S: Serialiser>(s: &mut S, type_: &str) {
+    s.begin_object();
+    field(s, "type", type_);
+    s.end_object();
+}
+
+impl Serialise for ErrorUpdate {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        field(s, "type", "error");
+        field(s, "message", &self.message);
+        s.end_object();
+    }
+}
+
+impl<A: Serialise> Serialise for StateUpdate<A> {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        field(s, "type", "update");
+        field(s, "gen", &self.gen);
+        opt_field(s, "windows", &self.windows);
+        opt_field(s, "content", &self.content);
+        opt_field(s, "input", &self.input);
+        opt_field(s, "timer", &self.timer);
+        opt_field(s, "disable", &self.disable);
+        opt_field(s, "specialinput", &self.specialinput);
+        opt_field(s, "debugoutput", &self.debugoutput);
+        opt_field(s, "page_margin_bg", &self.page_margin_bg);
+        opt_field(s, "autorestore", &self.autorestore);
+        s.end_object();
+    }
+}
+
+impl Serialise for ContentUpdate {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        match self {
+            ContentUpdate::BufferWindowContentUpdate(update) => {
+                s.begin_object();
+                update.base.serialise_fields(s);
+                opt_field(s, "text", &update.text);
+                s.end_object();
+            },
+            ContentUpdate::GraphicsWindowContentUpdate(update) => {
+                s.begin_object();
+                field(s, "id", &update.id);
+                field(s, "draw", &update.draw);
+                s.end_object();
+            },
+            ContentUpdate::GridWindowContentUpdate(update) => {
+                s.begin_object();
+                update.base.serialise_fields(s);
+                field(s, "lines", &update.lines);
+                s.end_object();
+            },
+        }
+    }
+}
+
+impl TextualWindowUpdate {
+    fn serialise_fields<S: Serialiser>(&self, s: &mut S) {
+        field(s, "id", &self.id);
+        opt_field(s, "clear", &self.clear);
+        opt_field(s, "bg", &self.bg);
+        opt_field(s, "fg", &self.fg);
+    }
+}
+
+impl Serialise for BufferWindowParagraphUpdate {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        opt_field(s, "append", &self.append);
+        opt_field(s, "content", &self.content);
+        opt_field(s, "flowbreak", &self.flowbreak);
+        s.end_object();
+    }
+}
+
+impl Serialise for GraphicsWindowOperation {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        match self {
+            GraphicsWindowOperation::FillOperation(op) => {
+                field(s, "special", "fill");
+                opt_field(s, "color", &op.color);
+                opt_field(s, "x", &op.x);
+                opt_field(s, "y", &op.y);
+                opt_field(s, "width", &op.width);
+                opt_field(s, "height", &op.height);
+            },
+            GraphicsWindowOperation::ImageOperation(op) => {
+                field(s, "special", "image");
+                opt_field(s, "image", &op.image);
+                opt_field(s, "url", &op.url);
+                field(s, "x", &op.x);
+                field(s, "y", &op.y);
+                field(s, "width", &op.width);
+                field(s, "height", &op.height);
+            },
+            GraphicsWindowOperation::SetcolorOperation(op) => {
+                field(s, "special", "setcolor");
+                field(s, "color", &op.color);
+            },
+        }
+        s.end_object();
+    }
+}
+
+impl Serialise for GridWindowLine {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        field(s, "line", &self.line);
+        opt_field(s, "content", &self.content);
+        s.end_object();
+    }
+}
+
+/** Line data is written into a flat array, with style pairs becoming two strings */
+impl Serialise for Vec<LineData> {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_array();
+        for data in self {
+            match data {
+                LineData::StylePair(style, text) => {
+                    s.str(style.name());
+                    s.str(text);
+                },
+                LineData::BufferWindowImage(image) => image.serialise(s),
+                LineData::TextRun(run) => run.serialise(s),
+            }
+        }
+        s.end_array();
+    }
+}
+
+impl Serialise for BufferWindowImage {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        field(s, "special", "image");
+        opt_field(s, "image", &self.image);
+        opt_field(s, "url", &self.url);
+        opt_field(s, "alignment", &self.alignment);
+        opt_field(s, "alttext", &self.alttext);
+        field(s, "width", &self.width);
+        field(s, "height", &self.height);
+        opt_field(s, "hyperlink", &self.hyperlink);
+        s.end_object();
+    }
+}
+
+impl Serialise for TextRun {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        field(s, "style", &self.style);
+        field(s, "text", &self.text);
+        opt_field(s, "hyperlink", &self.hyperlink);
+        opt_field(s, "css_styles", &self.css_styles);
+        s.end_object();
+    }
+}
+
+impl Serialise for InputUpdate {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        field(s, "id", &self.id);
+        opt_field(s, "gen", &self.gen);
+        opt_field(s, "type", &self.type_);
+        opt_field(s, "maxlen", &self.maxlen);
+        opt_field(s, "initial", &self.initial);
+        opt_field(s, "terminators", &self.terminators);
+        opt_field(s, "hyperlink", &self.hyperlink);
+        opt_field(s, "mouse", &self.mouse);
+        opt_field(s, "xpos", &self.xpos);
+        opt_field(s, "ypos", &self.ypos);
+        s.end_object();
+    }
+}
+
+impl Serialise for SpecialInput {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        field(s, "type", "fileref_prompt");
+        field(s, "filemode", &self.filemode);
+        field(s, "filetype", &self.filetype);
+        opt_field(s, "gameid", &self.gameid);
+        s.end_object();
+    }
+}
+
+impl Serialise for WindowUpdate {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        s.begin_object();
+        field(s, "id", &self.id);
+        field(s, "type", &self.type_);
+        field(s, "rock", &self.rock);
+        field(s, "left", &self.left);
+        field(s, "top", &self.top);
+        field(s, "width", &self.width);
+        field(s, "height", &self.height);
+        opt_field(s, "gridwidth", &self.gridwidth);
+        opt_field(s, "gridheight", &self.gridheight);
+        opt_field(s, "graphwidth", &self.graphwidth);
+        opt_field(s, "graphheight", &self.graphheight);
+        opt_field(s, "styles", &self.styles);
+        s.end_object();
+    }
+}
+
+impl Serialise for CSSValue {
+    fn serialise<S: Serialiser>(&self, s: &mut S) {
+        match self {
+            CSSValue::String(val) => s.str(val),
+            CSSValue::Number(val) => s.f64(*val),
+        }
+    }
+}
+
+macro_rules! serialise_string_enum {
+    ($($name:ident),*) => {
+        $(impl Serialise for $name {
+            fn serialise<S: Serialiser>(&self, s: &mut S) {
+                s.str(self.name());
+            }
+        })*
+    };
+}
+
+serialise_string_enum!(BufferWindowImageAlignment, FileMode, FileType, SpecialKeyCode, Style, TerminatorCode, TextInputType, WindowType);
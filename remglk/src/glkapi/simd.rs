@@ -0,0 +1,386 @@
+/*
+
+Vectorised array kernels
+========================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use super::{MAX_LATIN1, QUESTION_MARK};
+
+/** Widen a Latin-1 slice into a Unicode slice of the same length */
+pub fn widen_latin1(src: &[u8], dest: &mut [u32]) {
+    assert_eq!(src.len(), dest.len());
+    #[cfg(target_arch = "x86_64")]
+    {
+        if is_x86_feature_detected!("avx2") {
+            // Safety: we just checked that AVX2 is available
+            return unsafe {x86::widen_avx2(src, dest)};
+        }
+        // SSE2 is part of the x86_64 baseline
+        return unsafe {x86::widen_sse2(src, dest)};
+    }
+    #[allow(unreachable_code)]
+    widen_scalar(src, dest)
+}
+
+/** Narrow a Unicode slice into a Latin-1 slice of the same length, replacing non-Latin-1 characters with question marks */
+pub fn narrow_latin1(src: &[u32], dest: &mut [u8]) {
+    assert_eq!(src.len(), dest.len());
+    #[cfg(target_arch = "x86_64")]
+    {
+        if is_x86_feature_detected!("avx2") {
+            // Safety: we just checked that AVX2 is available
+            return unsafe {x86::narrow_avx2(src, dest)};
+        }
+        return unsafe {x86::narrow_sse2(src, dest)};
+    }
+    #[allow(unreachable_code)]
+    narrow_scalar(src, dest)
+}
+
+/** Find the first occurrence of a byte */
+pub fn find_u8(haystack: &[u8], needle: u8) -> Option<usize> {
+    #[cfg(target_arch = "x86_64")]
+    return unsafe {x86::find_u8_sse2(haystack, needle)};
+    #[allow(unreachable_code)]
+    haystack.iter().position(|&ch| ch == needle)
+}
+
+/** Find the first occurrence of a Unicode character */
+pub fn find_u32(haystack: &[u32], needle: u32) -> Option<usize> {
+    #[cfg(target_arch = "x86_64")]
+    return unsafe {x86::find_u32_sse2(haystack, needle)};
+    #[allow(unreachable_code)]
+    haystack.iter().position(|&ch| ch == needle)
+}
+
+/** Whether every character is below `bound` */
+pub fn all_below(chars: &[u32], bound: u32) -> bool {
+    #[cfg(target_arch = "x86_64")]
+    return unsafe {x86::all_below_sse2(chars, bound)};
+    #[allow(unreachable_code)]
+    chars.iter().all(|&ch| ch < bound)
+}
+
+/** Change the case of characters in place for as long as they are Latin-1 characters whose other case is also a single Latin-1 character, returning how many were done */
+pub fn change_case_latin1(chars: &mut [u32], upper: bool) -> usize {
+    #[cfg(target_arch = "x86_64")]
+    return unsafe {x86::change_case_latin1_sse2(chars, upper)};
+    #[allow(unreachable_code)]
+    change_case_latin1_scalar(chars, upper)
+}
+
+/** The portable version of `change_case_latin1`, also used for whatever the SIMD loop leaves */
+pub fn change_case_latin1_scalar(chars: &mut [u32], upper: bool) -> usize {
+    for (i, ch) in chars.iter_mut().enumerate() {
+        match (*ch, upper) {
+            (0x41..=0x5A | 0xC0..=0xD6 | 0xD8..=0xDE, false) => *ch += 0x20,
+            (0x61..=0x7A | 0xE0..=0xF6 | 0xF8..=0xFE, true) => *ch -= 0x20,
+            // These have no Latin-1 upper case
+            (0xB5 | 0xDF | 0xFF, true) => return i,
+            (0x100.., _) => return i,
+            _ => {},
+        }
+    }
+    chars.len()
+}
+
+fn widen_scalar(src: &[u8], dest: &mut [u32]) {
+    for (dest, &ch) in dest.iter_mut().zip(src) {
+        *dest = ch as u32;
+    }
+}
+
+fn narrow_scalar(src: &[u32], dest: &mut [u8]) {
+    for (dest, &ch) in dest.iter_mut().zip(src) {
+        *dest = if ch > MAX_LATIN1 {QUESTION_MARK} else {ch} as u8;
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+mod x86 {
+    use std::arch::x86_64::*;
+
+    use super::*;
+
+    #[target_feature(enable = "avx2")]
+    pub unsafe fn widen_avx2(src: &[u8], dest: &mut [u32]) {
+        let len = src.len();
+        let mut i = 0;
+        while i + 8 <= len {
+            let bytes = _mm_loadl_epi64(src.as_ptr().add(i) as *const __m128i);
+            _mm256_storeu_si256(dest.as_mut_ptr().add(i) as *mut __m256i, _mm256_cvtepu8_epi32(bytes));
+            i += 8;
+        }
+        widen_scalar(&src[i..], &mut dest[i..]);
+    }
+
+    #[target_feature(enable = "sse2")]
+    pub unsafe fn widen_sse2(src: &[u8], dest: &mut [u32]) {
+        let len = src.len();
+        let zero = _mm_setzero_si128();
+        let mut i = 0;
+        while i + 16 <= len {
+            let bytes = _mm_loadu_si128(src.as_ptr().add(i) as *const __m128i);
+            let low = _mm_unpacklo_epi8(bytes, zero);
+            let high = _mm_unpackhi_epi8(bytes, zero);
+            let out = dest.as_mut_ptr().add(i) as *mut __m128i;
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(out.add(1), _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(out.add(2), _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(out.add(3), _mm_unpackhi_epi16(high, zero));
+            i += 16;
+        }
+        widen_scalar(&src[i..], &mut dest[i..]);
+    }
+
+    #[target_feature(enable = "avx2")]
+    pub unsafe fn narrow_avx2(src: &[u32], dest: &mut [u8]) {
+        let len = src.len();
+        // Undo the per-lane interleaving of the packs below
+        let order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        let mut i = 0;
+        while i + 32 <= len {
+            let input = src.as_ptr().add(i) as *const __m256i;
+            let a = clamp_avx2(_mm256_loadu_si256(input));
+            let b = clamp_avx2(_mm256_loadu_si256(input.add(1)));
+            let c = clamp_avx2(_mm256_loadu_si256(input.add(2)));
+            let d = clamp_avx2(_mm256_loadu_si256(input.add(3)));
+            // All values are now <= 0xFF, so the saturating packs are exact
+            let packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+            _mm256_storeu_si256(dest.as_mut_ptr().add(i) as *mut __m256i, _mm256_permutevar8x32_epi32(packed, order));
+            i += 32;
+        }
+        narrow_scalar(&src[i..], &mut dest[i..]);
+    }
+
+    #[target_feature(enable = "sse2")]
+    pub unsafe fn narrow_sse2(src: &[u32], dest: &mut [u8]) {
+        let len = src.len();
+        let mut i = 0;
+        while i + 16 <= len {
+            let input = src.as_ptr().add(i) as *const __m128i;
+            let a = clamp_sse2(_mm_loadu_si128(input));
+            let b = clamp_sse2(_mm_loadu_si128(input.add(1)));
+            let c = clamp_sse2(_mm_loadu_si128(input.add(2)));
+            let d = clamp_sse2(_mm_loadu_si128(input.add(3)));
+            let packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+            _mm_storeu_si128(dest.as_mut_ptr().add(i) as *mut __m128i, packed);
+            i += 16;
+        }
+        narrow_scalar(&src[i..], &mut dest[i..]);
+    }
+
+    #[target_feature(enable = "sse2")]
+    pub unsafe fn find_u8_sse2(haystack: &[u8], needle: u8) -> Option<usize> {
+        let len = haystack.len();
+        let needles = _mm_set1_epi8(needle as i8);
+        let mut i = 0;
+        while i + 16 <= len {
+            let chunk = _mm_loadu_si128(haystack.as_ptr().add(i) as *const __m128i);
+            let mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needles));
+            if mask != 0 {
+                return Some(i + mask.trailing_zeros() as usize);
+            }
+            i += 16;
+        }
+        haystack[i..].iter().position(|&ch| ch == needle).map(|pos| i + pos)
+    }
+
+    #[target_feature(enable = "sse2")]
+    pub unsafe fn find_u32_sse2(haystack: &[u32], needle: u32) -> Option<usize> {
+        let len = haystack.len();
+        let needles = _mm_set1_epi32(needle as i32);
+        let mut i = 0;
+        while i + 8 <= len {
+            let input = haystack.as_ptr().add(i) as *const __m128i;
+            let a = _mm_cmpeq_epi32(_mm_loadu_si128(input), needles);
+            let b = _mm_cmpeq_epi32(_mm_loadu_si128(input.add(1)), needles);
+            // After packing each lane is 16 bits, so each match sets two bits of the mask
+            let mask = _mm_movemask_epi8(_mm_packs_epi32(a, b));
+            if mask != 0 {
+                return Some(i + mask.trailing_zeros() as usize / 2);
+            }
+            i += 8;
+        }
+        haystack[i..].iter().position(|&ch| ch == needle).map(|pos| i + pos)
+    }
+
+    #[target_feature(enable = "sse2")]
+    pub unsafe fn all_below_sse2(chars: &[u32], bound: u32) -> bool {
+        let len = chars.len();
+        let bounds = _mm_set1_epi32((bound ^ SIGN) as i32);
+        let mut i = 0;
+        while i + 4 <= len {
+            let v = _mm_loadu_si128(chars.as_ptr().add(i) as *const __m128i);
+            if _mm_movemask_epi8(lt_u32(v, bounds)) != 0xFFFF {
+                return false;
+            }
+            i += 4;
+        }
+        chars[i..].iter().all(|&ch| ch < bound)
+    }
+
+    #[target_feature(enable = "sse2")]
+    pub unsafe fn change_case_latin1_sse2(chars: &mut [u32], upper: bool) -> usize {
+        let len = chars.len();
+        // Upper case letters are 0x20 below lower case ones, in both ASCII and the rest of Latin-1
+        let (letters, accented, skip) = if upper {(0x61, 0xE0, 0xF7)} else {(0x41, 0xC0, 0xD7)};
+        let letters = _mm_set1_epi32(letters);
+        let accented = _mm_set1_epi32(accented);
+        let skip = _mm_set1_epi32(skip);
+        let letters_len = _mm_set1_epi32((26 ^ SIGN) as i32);
+        let accented_len = _mm_set1_epi32((31 ^ SIGN) as i32);
+        let latin1_end = _mm_set1_epi32((0x100 ^ SIGN) as i32);
+        let delta = _mm_set1_epi32(if upper {-0x20} else {0x20});
+        let mut i = 0;
+        while i + 4 <= len {
+            let ptr = chars.as_mut_ptr().add(i) as *mut __m128i;
+            let v = _mm_loadu_si128(ptr);
+            let mut simple = lt_u32(v, latin1_end);
+            if upper {
+                for special in [0xB5, 0xDF, 0xFF] {
+                    simple = _mm_andnot_si128(_mm_cmpeq_epi32(v, _mm_set1_epi32(special)), simple);
+                }
+            }
+            if _mm_movemask_epi8(simple) != 0xFFFF {
+                break;
+            }
+            let is_letter = lt_u32(_mm_sub_epi32(v, letters), letters_len);
+            let is_accented = _mm_andnot_si128(_mm_cmpeq_epi32(v, skip), lt_u32(_mm_sub_epi32(v, accented), accented_len));
+            let change = _mm_and_si128(_mm_or_si128(is_letter, is_accented), delta);
+            _mm_storeu_si128(ptr, _mm_add_epi32(v, change));
+            i += 4;
+        }
+        i + change_case_latin1_scalar(&mut chars[i..], upper)
+    }
+
+    const SIGN: u32 = 0x8000_0000;
+
+    /** Unsigned less than, for a `v` and an `bound` which has already been flipped by SIGN */
+    #[inline]
+    #[target_feature(enable = "sse2")]
+    unsafe fn lt_u32(v: __m128i, bound: __m128i) -> __m128i {
+        _mm_cmpgt_epi32(bound, _mm_xor_si128(v, _mm_set1_epi32(SIGN as i32)))
+    }
+
+    /** Replace any lanes above MAX_LATIN1 with question marks */
+    #[inline]
+    #[target_feature(enable = "avx2")]
+    unsafe fn clamp_avx2(v: __m256i) -> __m256i {
+        let high_bits = _mm256_and_si256(v, _mm256_set1_epi32(!MAX_LATIN1 as i32));
+        let latin1 = _mm256_cmpeq_epi32(high_bits, _mm256_setzero_si256());
+        _mm256_blendv_epi8(_mm256_set1_epi32(QUESTION_MARK as i32), v, latin1)
+    }
+
+    #[inline]
+    #[target_feature(enable = "sse2")]
+    unsafe fn clamp_sse2(v: __m128i) -> __m128i {
+        let high_bits = _mm_and_si128(v, _mm_set1_epi32(!MAX_LATIN1 as i32));
+        let latin1 = _mm_cmpeq_epi32(high_bits, _mm_setzero_si128());
+        _mm_or_si128(_mm_and_si128(latin1, v), _mm_andnot_si128(latin1, _mm_set1_epi32(QUESTION_MARK as i32)))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /** Every length up to 70, from several starting offsets, so that both the vector loops and the scalar tails are run, on unaligned data */
+    fn slices<T>(data: &[T]) -> impl Iterator<Item = &[T]> {
+        (0..4).flat_map(move |start| (0..=70).map(move |len| &data[start..start + len]))
+    }
+
+    /** Characters including ones just past Latin-1, and ones with the sign bit set */
+    fn unicode_chars() -> Vec<u32> {
+        const SPECIAL: [u32; 8] = [0xFF, 0x100, 0x7F, 0x80, 0xFFFF, 0x8000_0000, u32::MAX, 0x10FFFF];
+        (0..80u32).map(|i| if i % 5 == 3 {SPECIAL[i as usize / 5 % SPECIAL.len()]} else {0x20 + i * 3}).collect()
+    }
+
+    fn check_widen(widen: impl Fn(&[u8], &mut [u32])) {
+        let data: Vec<u8> = (0..80u32).map(|i| (i * 37 + 0x7B) as u8).collect();
+        for src in slices(&data) {
+            let mut expected = vec![0; src.len()];
+            widen_scalar(src, &mut expected);
+            let mut dest = vec![0xDEAD; src.len()];
+            widen(src, &mut dest);
+            assert_eq!(dest, expected, "length {}", src.len());
+        }
+    }
+
+    fn check_narrow(narrow: impl Fn(&[u32], &mut [u8])) {
+        let data = unicode_chars();
+        for src in slices(&data) {
+            let expected: Vec<u8> = src.iter().map(|&ch| if ch > MAX_LATIN1 {QUESTION_MARK as u8} else {ch as u8}).collect();
+            let mut dest = vec![0xAA; src.len()];
+            narrow(src, &mut dest);
+            assert_eq!(dest, expected, "length {}", src.len());
+        }
+    }
+
+    #[test]
+    fn widen() {
+        check_widen(widen_latin1);
+        #[cfg(target_arch = "x86_64")]
+        {
+            check_widen(|src, dest| unsafe {x86::widen_sse2(src, dest)});
+            if is_x86_feature_detected!("avx2") {
+                check_widen(|src, dest| unsafe {x86::widen_avx2(src, dest)});
+            }
+        }
+    }
+
+    #[test]
+    fn narrow() {
+        check_narrow(narrow_latin1);
+        check_narrow(narrow_scalar);
+        #[cfg(target_arch = "x86_64")]
+        {
+            check_narrow(|src, dest| unsafe {x86::narrow_sse2(src, dest)});
+            if is_x86_feature_detected!("avx2") {
+                check_narrow(|src, dest| unsafe {x86::narrow_avx2(src, dest)});
+            }
+        }
+    }
+
+    /** Look for a needle put at each position of each slice, then at two positions, then nowhere */
+    fn check_find<T: Copy + PartialEq>(data: &[T], needle: T, find: impl Fn(&[T], T) -> Option<usize>) {
+        let mut data = data.to_vec();
+        for start in 0..4 {
+            for len in 0..=70 {
+                let range = start..start + len;
+                assert_eq!(find(&data[range.clone()], needle), None, "length {}", len);
+                for pos in range.clone() {
+                    let old = data[pos];
+                    data[pos] = needle;
+                    assert_eq!(find(&data[range.clone()], needle), Some(pos - start), "length {} position {}", len, pos - start);
+                    if pos + 3 < range.end {
+                        data[pos + 3] = needle;
+                        assert_eq!(find(&data[range.clone()], needle), Some(pos - start));
+                        data[pos + 3] = old;
+                    }
+                    data[pos] = old;
+                }
+            }
+        }
+    }
+
+    #[test]
+    fn find() {
+        let bytes: Vec<u8> = (0..80u32).map(|i| (i % 250) as u8 + 1).collect();
+        let chars = unicode_chars();
+        check_find(&bytes, 0, find_u8);
+        check_find(&bytes, 0xFF, find_u8);
+        check_find(&chars, 0, find_u32);
+        check_find(&chars, 0xFFFF_FFFE, find_u32);
+        #[cfg(target_arch = "x86_64")]
+        {
+            check_find(&bytes, 0, |haystack, needle| unsafe {x86::find_u8_sse2(haystack, needle)});
+            check_find(&chars, 0, |haystack, needle| unsafe {x86::find_u32_sse2(haystack, needle)});
+        }
+    }
+}
@@ -0,0 +1,863 @@
+/*
+
+Library state snapshots
+=======================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::borrow::Cow;
+use std::collections::HashMap;
+use std::fs::{self, File};
+use std::io::{self, Write};
+use std::path::{Path, PathBuf};
+
+use super::atoms::Atom;
+use super::mmap::MappedFile;
+use super::protocol::*;
+
+/** A snapshot file
+ *
+ * Little endian throughout:
+ * - a 24 byte header: the magic bytes, format version (u32), section count (u32), and the offset of the section table (u64)
+ * - the sections, each starting on an 8 byte boundary
+ * - the section table, with a 24 byte entry for each section: its kind (u32), object ID (u32), offset (u64), and length (u64)
+ *
+ * Sections are only decoded when they're asked for, so restoring a session is mostly just mapping the file.
+ */
+const MAGIC: &[u8; 8] = b"RGLKSNAP";
+pub const VERSION: u32 = 1;
+const HEADER_LENGTH: usize = 24;
+const TABLE_ENTRY_LENGTH: usize = 24;
+
+/** What a section holds. Readers ignore kinds they don't know, so new kinds can be added without a version bump */
+#[derive(Clone, Copy, Debug, Eq, Hash, PartialEq)]
+pub enum SectionKind {
+    ArrayStream = 1,
+    BufferWindow = 2,
+    FileRef = 3,
+    FileStream = 4,
+    GridWindow = 5,
+    GrowableStream = 6,
+    WindowStyles = 7,
+    /** The objects an incremental snapshot removes, as (kind, ID) pairs */
+    Removed = 8,
+    /** A buffer window's scrollback, with the window's ID */
+    Scrollback = 9,
+}
+
+impl SectionKind {
+    fn from_u32(kind: u32) -> Option<Self> {
+        use SectionKind::*;
+        [ArrayStream, BufferWindow, FileRef, FileStream, GridWindow, GrowableStream, WindowStyles, Removed, Scrollback].get((kind as usize).wrapping_sub(1)).copied()
+    }
+}
+
+/** A section table entry */
+struct SectionEntry {
+    id: u32,
+    kind: u32,
+    len: usize,
+    offset: usize,
+}
+
+fn invalid(reason: &str) -> io::Error {
+    io::Error::new(io::ErrorKind::InvalidData, reason)
+}
+
+/** Builds a snapshot in memory */
+pub struct SnapshotWriter {
+    buf: Vec<u8>,
+    sections: Vec<SectionEntry>,
+}
+
+impl Default for SnapshotWriter {
+    fn default() -> Self {
+        SnapshotWriter {
+            buf: vec![0; HEADER_LENGTH],
+            sections: Vec::new(),
+        }
+    }
+}
+
+impl SnapshotWriter {
+    pub fn new() -> Self {
+        SnapshotWriter::default()
+    }
+
+    /** Start again, keeping the buffer's capacity */
+    pub fn clear(&mut self) {
+        self.buf.clear();
+        self.buf.resize(HEADER_LENGTH, 0);
+        self.sections.clear();
+    }
+
+    /** Add a section */
+    pub fn section(&mut self, kind: SectionKind, id: u32, write: impl FnOnce(&mut SectionWriter)) {
+        let offset = align(self.buf.len(), 8);
+        self.buf.resize(offset, 0);
+        write(&mut SectionWriter {
+            buf: &mut self.buf,
+        });
+        self.sections.push(SectionEntry {
+            id,
+            kind: kind as u32,
+            len: self.buf.len() - offset,
+            offset,
+        });
+    }
+
+    /** Drop the last section added */
+    pub(crate) fn discard_last_section(&mut self) {
+        if let Some(section) = self.sections.pop() {
+            self.buf.truncate(section.offset);
+        }
+    }
+
+    /** The contents of the last section added */
+    pub(crate) fn last_section(&self) -> &[u8] {
+        self.sections.last().map_or(&[], |section| &self.buf[section.offset..section.offset + section.len])
+    }
+
+    pub(crate) fn section_count(&self) -> usize {
+        self.sections.len()
+    }
+
+    /** Write the section table and header, returning the complete snapshot */
+    pub fn finish(&mut self) -> &[u8] {
+        let table_offset = align(self.buf.len(), 8);
+        self.buf.resize(table_offset, 0);
+        for section in &self.sections {
+            self.buf.extend_from_slice(&section.kind.to_le_bytes());
+            self.buf.extend_from_slice(&section.id.to_le_bytes());
+            self.buf.extend_from_slice(&(section.offset as u64).to_le_bytes());
+            self.buf.extend_from_slice(&(section.len as u64).to_le_bytes());
+        }
+        self.buf[0..8].copy_from_slice(MAGIC);
+        self.buf[8..12].copy_from_slice(&VERSION.to_le_bytes());
+        self.buf[12..16].copy_from_slice(&(self.sections.len() as u32).to_le_bytes());
+        self.buf[16..24].copy_from_slice(&(table_offset as u64).to_le_bytes());
+        &self.buf
+    }
+
+    /** Finish the snapshot and save it, replacing any existing file only once the new one is completely written */
+    pub fn save(&mut self, path: &Path) -> io::Result<()> {
+        let mut temp = path.as_os_str().to_owned();
+        temp.push(".tmp");
+        let temp = PathBuf::from(temp);
+        let mut file = File::create(&temp)?;
+        file.write_all(self.finish())?;
+        file.sync_data()?;
+        fs::rename(temp, path)
+    }
+}
+
+/** Writes the contents of one section */
+pub struct SectionWriter<'a> {
+    buf: &'a mut Vec<u8>,
+}
+
+impl SectionWriter<'_> {
+    /** Pad to a multiple of `alignment` bytes from the start of the snapshot */
+    pub fn align(&mut self, alignment: usize) {
+        let len = align(self.buf.len(), alignment);
+        self.buf.resize(len, 0);
+    }
+
+    pub fn bool(&mut self, val: bool) {
+        self.buf.push(val as u8);
+    }
+
+    /** Length prefixed bytes */
+    pub fn bytes(&mut self, val: &[u8]) {
+        self.usize(val.len());
+        self.buf.extend_from_slice(val);
+    }
+
+    pub fn f64(&mut self, val: f64) {
+        self.buf.extend_from_slice(&val.to_le_bytes());
+    }
+
+    pub fn opt_str(&mut self, val: Option<&str>) {
+        self.bool(val.is_some());
+        if let Some(val) = val {
+            self.str(val);
+        }
+    }
+
+    pub fn opt_u32(&mut self, val: Option<u32>) {
+        self.bool(val.is_some());
+        self.u32(val.unwrap_or(0));
+    }
+
+    pub fn str(&mut self, val: &str) {
+        self.bytes(val.as_bytes());
+    }
+
+    pub fn u8(&mut self, val: u8) {
+        self.buf.push(val);
+    }
+
+    pub fn u32(&mut self, val: u32) {
+        self.buf.extend_from_slice(&val.to_le_bytes());
+    }
+
+    /** Length prefixed u32s, aligned so they can be used in place */
+    pub fn u32_slice(&mut self, val: &[u32]) {
+        self.usize(val.len());
+        self.align(4);
+        self.buf.reserve(val.len() * 4);
+        for &val in val {
+            self.u32(val);
+        }
+    }
+
+    pub fn u64(&mut self, val: u64) {
+        self.buf.extend_from_slice(&val.to_le_bytes());
+    }
+
+    /** Length prefixed u64s, aligned so they can be used in place */
+    pub fn u64_slice(&mut self, val: &[u64]) {
+        self.usize(val.len());
+        self.align(8);
+        self.buf.reserve(val.len() * 8);
+        for &val in val {
+            self.u64(val);
+        }
+    }
+
+    pub fn usize(&mut self, val: usize) {
+        self.u64(val as u64);
+    }
+}
+
+fn align(len: usize, alignment: usize) -> usize {
+    len.div_ceil(alignment) * alignment
+}
+
+/** A snapshot file, memory mapped where possible */
+pub enum SnapshotFile {
+    Mapped(MappedFile),
+    Read(Vec<u8>),
+}
+
+impl SnapshotFile {
+    pub fn open(path: &Path) -> io::Result<Self> {
+        let file = File::open(path)?;
+        match MappedFile::map(&file, false) {
+            Ok(map) => Ok(SnapshotFile::Mapped(map)),
+            Err(err) if err.kind() == io::ErrorKind::Unsupported => Ok(SnapshotFile::Read(fs::read(path)?)),
+            Err(err) => Err(err),
+        }
+    }
+
+    pub fn as_slice(&self) -> &[u8] {
+        match self {
+            SnapshotFile::Mapped(map) => map.as_slice(),
+            SnapshotFile::Read(data) => data,
+        }
+    }
+
+    pub fn reader(&self) -> io::Result<SnapshotReader<'_>> {
+        SnapshotReader::new(self.as_slice())
+    }
+}
+
+/** Finds sections in a snapshot, borrowing from it */
+pub struct SnapshotReader<'a> {
+    index: HashMap<(u32, u32), usize>,
+    /** Sections in the order they were first written; removed sections are `None` */
+    sections: Vec<Option<Section<'a>>>,
+}
+
+#[derive(Clone, Copy)]
+struct Section<'a> {
+    /** Offset of the section in its snapshot, for alignment */
+    base: usize,
+    data: &'a [u8],
+    id: u32,
+    kind: u32,
+}
+
+impl<'a> SnapshotReader<'a> {
+    /** Check the header and read the section table */
+    pub fn new(data: &'a [u8]) -> io::Result<Self> {
+        if data.len() < HEADER_LENGTH || &data[0..8] != MAGIC {
+            return Err(invalid("Not a snapshot"));
+        }
+        let mut header = SectionReader::new(&data[8..HEADER_LENGTH]);
+        let version = header.u32()?;
+        if version > VERSION {
+            return Err(invalid("Snapshot is from a newer version"));
+        }
+        let count = header.u32()? as usize;
+        let table_offset = header.usize()?;
+        let table = table_offset.checked_add(count.saturating_mul(TABLE_ENTRY_LENGTH))
+            .and_then(|end| data.get(table_offset..end))
+            .ok_or_else(|| invalid("Truncated snapshot section table"))?;
+        let mut table = SectionReader::new(table);
+        let mut reader = SnapshotReader {
+            index: HashMap::with_capacity(count),
+            sections: Vec::with_capacity(count),
+        };
+        for _ in 0..count {
+            let kind = table.u32()?;
+            let id = table.u32()?;
+            let offset = table.usize()?;
+            let len = table.usize()?;
+            if offset.checked_add(len).is_none_or(|end| end > table_offset) {
+                return Err(invalid("Snapshot section out of bounds"));
+            }
+            reader.insert(Section {
+                base: offset,
+                data: &data[offset..offset + len],
+                id,
+                kind,
+            });
+        }
+        Ok(reader)
+    }
+
+    /** Apply a newer incremental snapshot on top of this one
+     *
+     * Its sections replace ours, and the objects listed in its `Removed` section are dropped.
+     */
+    pub fn apply(&mut self, delta: SnapshotReader<'a>) -> io::Result<()> {
+        if let Some(mut removed) = delta.section(SectionKind::Removed, 0) {
+            for _ in 0..removed.usize()? {
+                let key = (removed.u32()?, removed.u32()?);
+                if let Some(index) = self.index.remove(&key) {
+                    self.sections[index] = None;
+                }
+            }
+        }
+        for section in delta.sections.into_iter().flatten() {
+            if section.kind != SectionKind::Removed as u32 {
+                self.insert(section);
+            }
+        }
+        Ok(())
+    }
+
+    /** Get one section */
+    pub fn section(&self, kind: SectionKind, id: u32) -> Option<SectionReader<'a>> {
+        self.index.get(&(kind as u32, id)).and_then(|&index| self.sections[index]).map(Section::reader)
+    }
+
+    /** All the known sections, in the order they were written */
+    pub fn sections(&self) -> impl Iterator<Item = (SectionKind, u32, SectionReader<'a>)> + '_ {
+        self.sections.iter().flatten().filter_map(|section| match SectionKind::from_u32(section.kind) {
+            Some(SectionKind::Removed) | None => None,
+            Some(kind) => Some((kind, section.id, section.reader())),
+        })
+    }
+
+    /** All the sections of one kind */
+    pub fn sections_of(&self, kind: SectionKind) -> impl Iterator<Item = (u32, SectionReader<'a>)> + '_ {
+        self.sections.iter().flatten().filter(move |section| section.kind == kind as u32).map(|section| (section.id, section.reader()))
+    }
+
+    fn insert(&mut self, section: Section<'a>) {
+        match self.index.get(&(section.kind, section.id)) {
+            Some(&index) => self.sections[index] = Some(section),
+            None => {
+                self.index.insert((section.kind, section.id), self.sections.len());
+                self.sections.push(Some(section));
+            },
+        }
+    }
+}
+
+impl<'a> Section<'a> {
+    fn reader(self) -> SectionReader<'a> {
+        SectionReader {
+            base: self.base,
+            data: self.data,
+            pos: 0,
+        }
+    }
+}
+
+/** Reads the contents of one section */
+pub struct SectionReader<'a> {
+    /** Offset of the section in the snapshot, for alignment */
+    base: usize,
+    data: &'a [u8],
+    pos: usize,
+}
+
+impl<'a> SectionReader<'a> {
+    /** Read from a bare slice */
+    pub fn new(data: &'a [u8]) -> Self {
+        SectionReader {
+            base: 0,
+            data,
+            pos: 0,
+        }
+    }
+
+    pub fn align(&mut self, alignment: usize) {
+        self.pos = align(self.base + self.pos, alignment) - self.base;
+    }
+
+    pub fn bool(&mut self) -> io::Result<bool> {
+        Ok(self.u8()? != 0)
+    }
+
+    pub fn bytes(&mut self) -> io::Result<&'a [u8]> {
+        let len = self.usize()?;
+        self.take(len)
+    }
+
+    pub fn f64(&mut self) -> io::Result<f64> {
+        Ok(f64::from_le_bytes(self.array()?))
+    }
+
+    pub fn opt_str(&mut self) -> io::Result<Option<&'a str>> {
+        Ok(if self.bool()? {Some(self.str()?)} else {None})
+    }
+
+    pub fn opt_u32(&mut self) -> io::Result<Option<u32>> {
+        let some = self.bool()?;
+        let val = self.u32()?;
+        Ok(if some {Some(val)} else {None})
+    }
+
+    pub fn str(&mut self) -> io::Result<&'a str> {
+        std::str::from_utf8(self.bytes()?).map_err(|_| invalid("Invalid UTF-8 in snapshot"))
+    }
+
+    pub fn u8(&mut self) -> io::Result<u8> {
+        Ok(self.take(1)?[0])
+    }
+
+    pub fn u32(&mut self) -> io::Result<u32> {
+        Ok(u32::from_le_bytes(self.array()?))
+    }
+
+    /** Read u32s, borrowed from the snapshot when possible */
+    pub fn u32_slice(&mut self) -> io::Result<Cow<'a, [u32]>> {
+        let len = self.usize()?;
+        self.align(4);
+        let bytes = self.take(len.checked_mul(4).ok_or_else(|| invalid("Snapshot array too long"))?)?;
+        Ok(match in_place(bytes) {
+            Some(vals) => Cow::Borrowed(vals),
+            None => Cow::Owned(bytes.chunks_exact(4).map(|bytes| u32::from_le_bytes(bytes.try_into().unwrap())).collect()),
+        })
+    }
+
+    pub fn u64(&mut self) -> io::Result<u64> {
+        Ok(u64::from_le_bytes(self.array()?))
+    }
+
+    /** Read u64s, borrowed from the snapshot when possible */
+    pub fn u64_slice(&mut self) -> io::Result<Cow<'a, [u64]>> {
+        let len = self.usize()?;
+        self.align(8);
+        let bytes = self.take(len.checked_mul(8).ok_or_else(|| invalid("Snapshot array too long"))?)?;
+        Ok(match in_place(bytes) {
+            Some(vals) => Cow::Borrowed(vals),
+            None => Cow::Owned(bytes.chunks_exact(8).map(|bytes| u64::from_le_bytes(bytes.try_into().unwrap())).collect()),
+        })
+    }
+
+    pub fn usize(&mut self) -> io::Result<usize> {
+        usize::try_from(self.u64()?).map_err(|_| invalid("Snapshot value too big"))
+    }
+
+    fn array<const N: usize>(&mut self) -> io::Result<[u8; N]> {
+        Ok(self.take(N)?.try_into().unwrap())
+    }
+
+    fn take(&mut self, len: usize) -> io::Result<&'a [u8]> {
+        let bytes = self.pos.checked_add(len).and_then(|end| self.data.get(self.pos..end)).ok_or_else(|| invalid("Truncated snapshot section"))?;
+        self.pos += len;
+        Ok(bytes)
+    }
+}
+
+/** Use little endian integers directly from the snapshot, if the platform and alignment allow */
+fn in_place<T: Copy>(bytes: &[u8]) -> Option<&[T]> {
+    if cfg!(target_endian = "big") {
+        return None;
+    }
+    // Safety: u32 and u64 are valid for any bit pattern
+    let (before, vals, after) = unsafe {bytes.align_to::<T>()};
+    if before.is_empty() && after.is_empty() {Some(vals)} else {None}
+}
+
+/** Write a file reference */
+pub fn write_fileref(w: &mut SectionWriter, fref: &FileRef) {
+    w.str(&fref.filename);
+    w.opt_str(fref.content.as_deref());
+    w.opt_str(fref.dirent.as_deref());
+    w.opt_str(fref.gameid.as_deref());
+    w.opt_str(fref.usage.as_deref());
+}
+
+/** Read a file reference, borrowing its strings from the snapshot */
+pub fn read_fileref<'a>(r: &mut SectionReader<'a>) -> io::Result<FileRef<'a>> {
+    let filename = r.str()?.into();
+    Ok(FileRef {
+        content: r.opt_str()?.map(Cow::Borrowed),
+        dirent: r.opt_str()?.map(Cow::Borrowed),
+        filename,
+        gameid: r.opt_str()?.map(Cow::Borrowed),
+        usage: r.opt_str()?.map(Cow::Borrowed),
+    })
+}
+
+/** Write a window's styles */
+pub fn write_styles(w: &mut SectionWriter, styles: &WindowStyles) {
+    w.usize(styles.len());
+    for (selector, props) in styles {
+        w.str(selector.as_str());
+        w.usize(props.len());
+        for (prop, val) in props {
+            w.str(prop.as_str());
+            match val {
+                CSSValue::String(val) => {
+                    w.u8(0);
+                    w.str(val);
+                },
+                CSSValue::Number(val) => {
+                    w.u8(1);
+                    w.f64(*val);
+                },
+            }
+        }
+    }
+}
+
+/** Read window styles. Names are interned with `Atom::try_new`, so that a snapshot can't grow the atom table without limit */
+pub fn read_styles(r: &mut SectionReader) -> io::Result<WindowStyles> {
+    let atom = |name: &str| Atom::try_new(name).ok_or_else(|| invalid("Too many or too long style names in snapshot"));
+    let count = r.usize()?;
+    let mut styles = HashMap::new();
+    for _ in 0..count {
+        let selector = atom(r.str()?)?;
+        let prop_count = r.usize()?;
+        let mut props = HashMap::new();
+        for _ in 0..prop_count {
+            let prop = atom(r.str()?)?;
+            let val = match r.u8()? {
+                0 => CSSValue::String(r.str()?.to_owned()),
+                1 => CSSValue::Number(r.f64()?),
+                _ => return Err(invalid("Unknown CSS value type")),
+            };
+            props.insert(prop, val);
+        }
+        styles.insert(selector, props);
+    }
+    Ok(styles)
+}
+
+/** Read a string enum stored by name */
+pub fn read_name<T>(r: &mut SectionReader, from_name: fn(&str) -> Option<T>) -> io::Result<T> {
+    from_name(r.str()?).ok_or_else(|| invalid("Unknown name in snapshot"))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use super::super::constants::FileMode;
+    use super::super::file_streams::{FileEncoding, FileStream};
+    use super::super::pool::BufferPool;
+    use super::super::streams::{ArrayBackedStream, GrowableStream, Stream};
+    use super::super::windows::buffer::BufferWindowText;
+    use super::super::windows::grid::GridWindow;
+    use super::super::windows::scrollback::Scrollback;
+
+    const ARRAY_LENGTH: usize = 16;
+
+    /** A snapshot with one section */
+    fn one_section(kind: SectionKind, write: impl FnOnce(&mut SectionWriter)) -> Vec<u8> {
+        let mut writer = SnapshotWriter::new();
+        writer.section(kind, 0, write);
+        writer.finish().to_vec()
+    }
+
+    fn read_section<T>(data: &[u8], kind: SectionKind, read: impl FnOnce(&mut SectionReader) -> io::Result<T>) -> io::Result<T> {
+        let reader = SnapshotReader::new(data)?;
+        read(&mut reader.section(kind, 0).unwrap())
+    }
+
+    fn is_invalid<T>(result: io::Result<T>) -> bool {
+        matches!(result, Err(err) if err.kind() == io::ErrorKind::InvalidData)
+    }
+
+    /** A snapshot with a section of each kind that can be restored on its own */
+    fn sample() -> Vec<u8> {
+        let mut writer = SnapshotWriter::new();
+
+        let mut buf = [0u32; ARRAY_LENGTH];
+        let mut stream = ArrayBackedStream::new(&mut buf, FileMode::ReadWrite, 11, None);
+        stream.put_string("Hello", None);
+        writer.section(SectionKind::ArrayStream, 1, |w| stream.snapshot(w));
+
+        let mut buffer = BufferWindowText::new();
+        buffer.put_str("West of House\n");
+        buffer.set_style(Style::Emphasized);
+        buffer.set_hyperlink(Some(3));
+        buffer.put_str("You are standing in an open field. ☃");
+        writer.section(SectionKind::BufferWindow, 2, |w| buffer.snapshot(w));
+
+        writer.section(SectionKind::FileRef, 3, |w| write_fileref(w, &FileRef {
+            content: None,
+            dirent: Some("/saves/game.glksave".into()),
+            filename: "game.glksave".into(),
+            gameid: Some("ZORK".into()),
+            usage: None,
+        }));
+
+        for id in [4, 5] {
+            let mut grid = GridWindow::new(id as usize, 3);
+            grid.set_style(Style::Subheader);
+            grid.put_str("Score: 10");
+            grid.move_cursor(1, 2);
+            writer.section(SectionKind::GridWindow, id, |w| grid.snapshot(w));
+        }
+
+        let mut stream = GrowableStream::new(BufferPool::<u32>::new_shared(), &[0x41, 0x2603, 0x1F600], FileMode::ReadWrite, 12);
+        stream.put_string("xyz", None);
+        writer.section(SectionKind::GrowableStream, 6, |w| stream.snapshot(w));
+        let mut stream = GrowableStream::new(BufferPool::<u8>::new_shared(), b"Latin-1", FileMode::WriteAppend, 13);
+        stream.put_string("!", None);
+        writer.section(SectionKind::GrowableStream, 7, |w| stream.snapshot(w));
+
+        let mut styles = WindowStyles::new();
+        styles.insert(Atom::from("div.Style_header"), HashMap::from([(Atom::COLOR, CSSValue::String("#ff0000".into()))]));
+        writer.section(SectionKind::WindowStyles, 8, |w| write_styles(w, &styles));
+
+        let mut scrollback = Scrollback::new();
+        scrollback.push_paragraph(false, true, "First", [(5, None, Style::Header)].into_iter());
+        scrollback.push_paragraph(false, false, "Second ☃", [(3, Some(9), Style::Normal), (10, None, Style::Note)].into_iter());
+        writer.section(SectionKind::Scrollback, 9, |w| scrollback.snapshot(w));
+
+        writer.finish().to_vec()
+    }
+
+    /** Restore a section and write it out again */
+    fn restore(writer: &mut SnapshotWriter, kind: SectionKind, id: u32, r: &mut SectionReader) -> io::Result<()> {
+        match kind {
+            SectionKind::ArrayStream => {
+                let mut buf = [0u32; ARRAY_LENGTH];
+                let stream = ArrayBackedStream::from_snapshot(r, &mut buf, None)?;
+                writer.section(kind, id, |w| stream.snapshot(w));
+            },
+            SectionKind::BufferWindow => {
+                let buffer = BufferWindowText::from_snapshot(r)?;
+                writer.section(kind, id, |w| buffer.snapshot(w));
+            },
+            SectionKind::FileRef => {
+                let fref = read_fileref(r)?;
+                writer.section(kind, id, |w| write_fileref(w, &fref));
+            },
+            SectionKind::FileStream => {
+                let mut stream = FileStream::from_snapshot(r)?;
+                let mut result = Ok(());
+                writer.section(kind, id, |w| result = stream.snapshot(w));
+                result?;
+            },
+            SectionKind::GridWindow => {
+                let grid = GridWindow::from_snapshot(r)?;
+                writer.section(kind, id, |w| grid.snapshot(w));
+            },
+            SectionKind::GrowableStream => {
+                // The sample Unicode stream is object 6
+                if id == 6 {
+                    let stream = GrowableStream::from_snapshot(r, BufferPool::<u32>::new_shared())?;
+                    writer.section(kind, id, |w| stream.snapshot(w));
+                }
+                else {
+                    let stream = GrowableStream::from_snapshot(r, BufferPool::<u8>::new_shared())?;
+                    writer.section(kind, id, |w| stream.snapshot(w));
+                }
+            },
+            SectionKind::WindowStyles => {
+                let styles = read_styles(r)?;
+                writer.section(kind, id, |w| write_styles(w, &styles));
+            },
+            SectionKind::Removed => panic!("Removed sections can't be restored"),
+            SectionKind::Scrollback => {
+                let mut scrollback = Scrollback::new();
+                scrollback.from_snapshot(r)?;
+                writer.section(kind, id, |w| scrollback.snapshot(w));
+            },
+        }
+        Ok(())
+    }
+
+    /** Restore every section of a snapshot and write them all out again */
+    fn restore_all(data: &[u8]) -> io::Result<Vec<u8>> {
+        let reader = SnapshotReader::new(data)?;
+        let mut writer = SnapshotWriter::new();
+        for (kind, id, mut r) in reader.sections() {
+            restore(&mut writer, kind, id, &mut r)?;
+        }
+        Ok(writer.finish().to_vec())
+    }
+
+    /** Every proper prefix of each section must be rejected */
+    fn check_truncated_sections(data: &[u8]) {
+        let reader = SnapshotReader::new(data).unwrap();
+        for (kind, id, r) in reader.sections() {
+            for len in 0..r.data.len() {
+                let mut truncated = SectionReader {
+                    base: r.base,
+                    data: &r.data[..len],
+                    pos: 0,
+                };
+                assert!(is_invalid(restore(&mut SnapshotWriter::new(), kind, id, &mut truncated)), "{:?} section {} truncated to {} bytes", kind as u32, id, len);
+            }
+        }
+    }
+
+    #[test]
+    fn round_trip() {
+        let data = sample();
+        assert_eq!(restore_all(&data).unwrap(), data);
+
+        let reader = SnapshotReader::new(&data).unwrap();
+        assert_eq!(reader.sections().count(), 9);
+        assert_eq!(reader.sections_of(SectionKind::GridWindow).map(|(id, _)| id).collect::<Vec<_>>(), [4, 5]);
+        assert_eq!(GridWindow::from_snapshot(&mut reader.section(SectionKind::GridWindow, 5).unwrap()).unwrap().width(), 5);
+        assert!(reader.section(SectionKind::GridWindow, 6).is_none());
+        assert!(reader.section(SectionKind::Removed, 0).is_none());
+
+        // Sections of unknown kinds are skipped
+        let mut writer = SnapshotWriter::new();
+        writer.section(SectionKind::FileRef, 1, |w| write_fileref(w, &FileRef {
+            content: None,
+            dirent: None,
+            filename: "a".into(),
+            gameid: None,
+            usage: None,
+        }));
+        let mut data = writer.finish().to_vec();
+        let table_offset = data.len() - TABLE_ENTRY_LENGTH;
+        data[table_offset..table_offset + 4].copy_from_slice(&99u32.to_le_bytes());
+        assert_eq!(SnapshotReader::new(&data).unwrap().sections().count(), 0);
+    }
+
+    #[test]
+    fn file_stream() {
+        let path = std::env::temp_dir().join(format!("remglk-snapshot-test-{}", std::process::id()));
+        fs::write(&path, "Some text\n").unwrap();
+        let mut stream = FileStream::open(&path, FileMode::ReadWrite, FileEncoding::UTF8, 14).unwrap();
+        stream.put_string("More", None);
+        let mut writer = SnapshotWriter::new();
+        let mut result = Ok(());
+        writer.section(SectionKind::FileStream, 1, |w| result = stream.snapshot(w));
+        result.unwrap();
+        let data = writer.finish().to_vec();
+        drop(stream);
+        assert_eq!(fs::read(&path).unwrap(), b"More text\n");
+        assert_eq!(restore_all(&data).unwrap(), data);
+        check_truncated_sections(&data);
+        fs::remove_file(&path).unwrap();
+    }
+
+    #[test]
+    fn removed() {
+        let data = sample();
+        let mut reader = SnapshotReader::new(&data).unwrap();
+        let mut writer = SnapshotWriter::new();
+        writer.section(SectionKind::Removed, 0, |w| {
+            w.usize(2);
+            w.u32(SectionKind::GridWindow as u32);
+            w.u32(4);
+            // Objects which don't exist are ignored
+            w.u32(SectionKind::GridWindow as u32);
+            w.u32(40);
+        });
+        let mut grid = GridWindow::new(2, 2);
+        grid.put_str("New");
+        writer.section(SectionKind::GridWindow, 5, |w| grid.snapshot(w));
+        writer.section(SectionKind::GridWindow, 10, |w| grid.snapshot(w));
+        let delta = writer.finish().to_vec();
+        reader.apply(SnapshotReader::new(&delta).unwrap()).unwrap();
+        let grids: Vec<_> = reader.sections_of(SectionKind::GridWindow).map(|(id, mut r)| (id, GridWindow::from_snapshot(&mut r).unwrap().width())).collect();
+        assert_eq!(grids, [(5, 2), (10, 2)]);
+        assert_eq!(reader.sections().count(), 9);
+        assert!(reader.section(SectionKind::GridWindow, 4).is_none());
+
+        // A truncated removed section
+        let mut reader = SnapshotReader::new(&data).unwrap();
+        let delta = one_section(SectionKind::Removed, |w| {
+            w.usize(2);
+            w.u32(SectionKind::GridWindow as u32);
+            w.u32(4);
+        });
+        assert!(is_invalid(reader.apply(SnapshotReader::new(&delta).unwrap())));
+    }
+
+    #[test]
+    fn truncated() {
+        let data = sample();
+        for len in 0..data.len() {
+            assert!(is_invalid(SnapshotReader::new(&data[..len])), "Snapshot truncated to {} bytes", len);
+        }
+        check_truncated_sections(&data);
+
+        // A zero width grid can't claim an unbounded number of lines
+        let data = one_section(SectionKind::GridWindow, |w| {
+            w.usize(0);
+            w.usize(usize::MAX >> 8);
+            w.usize(0);
+            w.usize(0);
+            w.str("normal");
+            w.opt_u32(None);
+            w.u64_slice(&[]);
+        });
+        assert!(is_invalid(read_section(&data, SectionKind::GridWindow, GridWindow::from_snapshot)));
+    }
+
+    #[test]
+    fn corrupted() {
+        let data = sample();
+        let mut corrupted = data.clone();
+        for i in 0..data.len() {
+            for flip in [0x01, 0x80, 0xFF] {
+                corrupted[i] ^= flip;
+                let result = restore_all(&corrupted);
+                assert!(result.is_ok() || is_invalid(result), "Byte {} flipped with {:#x}", i, flip);
+                corrupted[i] = data[i];
+            }
+        }
+    }
+
+    #[test]
+    fn styles() {
+        let mut styles = WindowStyles::new();
+        styles.insert(Atom::from("div.Style_normal"), HashMap::from([
+            (Atom::COLOR, CSSValue::String("#123456".into())),
+            (Atom::from("padding"), CSSValue::Number(2.0)),
+        ]));
+        styles.insert(Atom::from("span.Style_user3"), HashMap::from([(Atom::from("font-stretch"), CSSValue::String("condensed".into()))]));
+        let data = one_section(SectionKind::WindowStyles, |w| write_styles(w, &styles));
+        assert_eq!(read_section(&data, SectionKind::WindowStyles, read_styles).unwrap(), styles);
+
+        // Names which have never been interned, as when autorestoring in a new process
+        let data = one_section(SectionKind::WindowStyles, |w| {
+            w.usize(1);
+            w.str("div.Style_snapshot_test");
+            w.usize(1);
+            w.str("x-snapshot-test");
+            w.u8(1);
+            w.f64(3.5);
+        });
+        let restored = read_section(&data, SectionKind::WindowStyles, read_styles).unwrap();
+        assert_eq!(restored[&Atom::from("div.Style_snapshot_test")][&Atom::from("x-snapshot-test")], CSSValue::Number(3.5));
+
+        let data = one_section(SectionKind::WindowStyles, |w| {
+            w.usize(1);
+            w.str(&"x".repeat(1000));
+            w.usize(0);
+        });
+        assert!(is_invalid(read_section(&data, SectionKind::WindowStyles, read_styles)));
+    }
+}
@@ -0,0 +1,289 @@
+/*
+
+Incremental snapshots
+=====================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::collections::hash_map::DefaultHasher;
+use std::collections::HashMap;
+use std::fs::{self, File, OpenOptions};
+use std::hash::Hasher;
+use std::io::{self, Write};
+use std::path::{Path, PathBuf};
+
+use super::snapshot::*;
+
+/** Write a full snapshot after this many incremental ones by default */
+const DEFAULT_MAX_DELTAS: usize = 64;
+
+/** An append only log of snapshots
+ *
+ * The log file is a series of frames, each a u64 length followed by a complete snapshot, padded to 8 bytes. The first frame is a full snapshot, and each later frame only has the sections which changed in that turn, plus a `Removed` section listing the objects which no longer exist.
+ *
+ * Each object's section is still built every turn, but it's only written when its hash differs from what was last written. Once the incremental frames have added up to more than the full snapshot, or after `max_deltas` of them, the log is compacted by writing a new full snapshot in its place.
+ */
+pub struct SnapshotLog {
+    /** Bytes of incremental frames since the last full snapshot */
+    delta_bytes: u64,
+    delta_count: usize,
+    file: Option<File>,
+    full: bool,
+    full_bytes: u64,
+    /** The hash of each object's last written section, and the turn it was last seen */
+    hashes: HashMap<(u32, u32), (u64, u64)>,
+    max_deltas: usize,
+    path: PathBuf,
+    turn: u64,
+    writer: SnapshotWriter,
+}
+
+impl SnapshotLog {
+    /** Start a log at `path`. Nothing is written until the first commit, which is always a full snapshot */
+    pub fn new(path: &Path) -> Self {
+        SnapshotLog {
+            delta_bytes: 0,
+            delta_count: 0,
+            file: None,
+            full: true,
+            full_bytes: 0,
+            hashes: HashMap::new(),
+            max_deltas: DEFAULT_MAX_DELTAS,
+            path: path.to_owned(),
+            turn: 0,
+            writer: SnapshotWriter::new(),
+        }
+    }
+
+    /** Read a log, combining all of its frames. A torn final frame (from a crash mid write) is ignored */
+    pub fn read(data: &[u8]) -> io::Result<SnapshotReader<'_>> {
+        let mut frames = data;
+        let mut reader: Option<SnapshotReader> = None;
+        while frames.len() >= 8 {
+            let len = u64::from_le_bytes(frames[..8].try_into().unwrap());
+            let frame_end = usize::try_from(len).ok().and_then(|len| len.checked_add(8));
+            let frame = match frame_end.and_then(|end| frames.get(8..end)) {
+                Some(frame) => frame,
+                None => break,
+            };
+            let snapshot = SnapshotReader::new(frame)?;
+            match &mut reader {
+                Some(reader) => reader.apply(snapshot)?,
+                None => reader = Some(snapshot),
+            }
+            let padded_end = frame_end.unwrap().div_ceil(8) * 8;
+            frames = frames.get(padded_end..).unwrap_or(&[]);
+        }
+        reader.ok_or_else(|| io::Error::new(io::ErrorKind::InvalidData, "Snapshot log is empty"))
+    }
+
+    /** Make the next commit a full snapshot */
+    pub fn compact_next(&mut self) {
+        self.full = true;
+    }
+
+    pub fn set_max_deltas(&mut self, max_deltas: usize) {
+        self.max_deltas = max_deltas;
+    }
+
+    /** Start a new turn's snapshot. Every live object must then be given to `section` before `commit` */
+    pub fn begin(&mut self) {
+        self.turn += 1;
+        self.writer.clear();
+        if self.delta_count >= self.max_deltas || self.delta_bytes > self.full_bytes {
+            self.full = true;
+        }
+    }
+
+    /** Add an object's section, which will be dropped again if it hasn't changed since it was last written */
+    pub fn section(&mut self, kind: SectionKind, id: u32, write: impl FnOnce(&mut SectionWriter)) {
+        self.writer.section(kind, id, write);
+        let mut hasher = DefaultHasher::new();
+        hasher.write(self.writer.last_section());
+        let hash = hasher.finish();
+        let previous = self.hashes.insert((kind as u32, id), (hash, self.turn));
+        if !self.full && previous.map(|(previous, _)| previous) == Some(hash) {
+            self.writer.discard_last_section();
+        }
+    }
+
+    /** Write this turn's snapshot, returning how many bytes were written */
+    pub fn commit(&mut self) -> io::Result<usize> {
+        // Anything not seen this turn has been removed
+        let turn = self.turn;
+        let mut removed = Vec::new();
+        self.hashes.retain(|&key, &mut (_, seen)| {
+            if seen != turn {
+                removed.push(key);
+            }
+            seen == turn
+        });
+        if self.full {
+            return self.write_full();
+        }
+        if !removed.is_empty() {
+            self.writer.section(SectionKind::Removed, 0, |w| {
+                w.usize(removed.len());
+                for (kind, id) in removed {
+                    w.u32(kind);
+                    w.u32(id);
+                }
+            });
+        }
+        if self.writer.section_count() == 0 {
+            return Ok(0);
+        }
+        let result = match &mut self.file {
+            Some(file) => write_frame(file, self.writer.finish()),
+            None => return self.write_full(),
+        };
+        match result {
+            Ok(written) => {
+                self.delta_bytes += written as u64;
+                self.delta_count += 1;
+                Ok(written)
+            },
+            Err(err) => {
+                // The log may now end with a torn frame, and the hashes are for sections which weren't saved
+                self.full = true;
+                Err(err)
+            },
+        }
+    }
+
+    /** Replace the log with a single full snapshot */
+    fn write_full(&mut self) -> io::Result<usize> {
+        let mut temp = self.path.as_os_str().to_owned();
+        temp.push(".tmp");
+        let temp = PathBuf::from(temp);
+        let mut file = File::create(&temp)?;
+        let written = write_frame(&mut file, self.writer.finish())?;
+        file.sync_data()?;
+        fs::rename(&temp, &self.path)?;
+        self.file = Some(OpenOptions::new().append(true).open(&self.path)?);
+        self.delta_bytes = 0;
+        self.delta_count = 0;
+        self.full = false;
+        self.full_bytes = written as u64;
+        Ok(written)
+    }
+}
+
+fn write_frame(file: &mut File, snapshot: &[u8]) -> io::Result<usize> {
+    let padding = snapshot.len().div_ceil(8) * 8 - snapshot.len();
+    file.write_all(&(snapshot.len() as u64).to_le_bytes())?;
+    file.write_all(snapshot)?;
+    file.write_all(&[0; 8][..padding])?;
+    Ok(8 + snapshot.len() + padding)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /** Write a turn where each object's section is just a value */
+    fn turn(log: &mut SnapshotLog, objects: &[(u32, u32)]) -> usize {
+        log.begin();
+        for &(id, val) in objects {
+            log.section(SectionKind::GridWindow, id, |w| w.u32(val));
+        }
+        log.commit().unwrap()
+    }
+
+    /** The objects in a log, and their values */
+    fn objects(data: &[u8]) -> Vec<(u32, u32)> {
+        let reader = SnapshotLog::read(data).unwrap();
+        let objects = reader.sections_of(SectionKind::GridWindow).map(|(id, mut r)| (id, r.u32().unwrap())).collect();
+        objects
+    }
+
+    fn temp_path(name: &str) -> PathBuf {
+        std::env::temp_dir().join(format!("remglk-snapshot-log-test-{}-{}", name, std::process::id()))
+    }
+
+    #[test]
+    fn deltas() {
+        let path = temp_path("deltas");
+        let mut log = SnapshotLog::new(&path);
+        let full = turn(&mut log, &[(1, 10), (2, 20), (3, 30)]);
+        assert_eq!(fs::metadata(&path).unwrap().len(), full as u64);
+        // Nothing changed
+        assert_eq!(turn(&mut log, &[(1, 10), (2, 20), (3, 30)]), 0);
+        let delta = turn(&mut log, &[(1, 11), (2, 20), (3, 30)]);
+        assert!(delta < full);
+        turn(&mut log, &[(1, 11), (3, 30), (4, 40)]);
+        let data = fs::read(&path).unwrap();
+        assert_eq!(objects(&data), [(1, 11), (3, 30), (4, 40)]);
+
+        // Every truncation of the last frame gives the previous turn
+        let last_frame = full + delta;
+        for len in last_frame..data.len() {
+            assert_eq!(objects(&data[..len]), [(1, 11), (2, 20), (3, 30)], "Log truncated to {} bytes", len);
+        }
+        for len in full..last_frame {
+            assert_eq!(objects(&data[..len]), [(1, 10), (2, 20), (3, 30)], "Log truncated to {} bytes", len);
+        }
+        fs::remove_file(&path).unwrap();
+    }
+
+    #[test]
+    fn invalid() {
+        let is_invalid = |data: &[u8]| matches!(SnapshotLog::read(data), Err(err) if err.kind() == io::ErrorKind::InvalidData);
+        assert!(is_invalid(&[]));
+        assert!(is_invalid(&[0; 7]));
+        // A torn first frame leaves nothing to read
+        let path = temp_path("invalid");
+        let mut log = SnapshotLog::new(&path);
+        let full = turn(&mut log, &[(1, 10)]);
+        turn(&mut log, &[(1, 11)]);
+        let mut data = fs::read(&path).unwrap();
+        for len in 0..full {
+            assert!(is_invalid(&data[..len]), "Log truncated to {} bytes", len);
+        }
+        // A complete frame which isn't a snapshot
+        data[full + 8] ^= 0xFF;
+        assert!(is_invalid(&data));
+        fs::remove_file(&path).unwrap();
+    }
+
+    #[test]
+    fn compaction() {
+        let path = temp_path("compaction");
+        let mut log = SnapshotLog::new(&path);
+        log.set_max_deltas(2);
+        let full = turn(&mut log, &[(1, 10), (2, 20), (3, 30), (4, 40)]);
+        turn(&mut log, &[(1, 11), (2, 20), (3, 30), (4, 40)]);
+        turn(&mut log, &[(1, 12), (2, 20), (3, 30), (4, 40)]);
+        assert!(fs::metadata(&path).unwrap().len() > full as u64);
+        // The third delta becomes a full snapshot instead
+        assert_eq!(turn(&mut log, &[(1, 13), (2, 20), (3, 30), (4, 40)]), full);
+        let data = fs::read(&path).unwrap();
+        assert_eq!(data.len(), full);
+        assert_eq!(objects(&data), [(1, 13), (2, 20), (3, 30), (4, 40)]);
+
+        // Compact on request, even when nothing changed
+        turn(&mut log, &[(1, 14), (2, 20), (3, 30), (4, 40)]);
+        log.compact_next();
+        assert_eq!(turn(&mut log, &[(1, 14), (2, 20), (3, 30)]), fs::metadata(&path).unwrap().len() as usize);
+        assert_eq!(objects(&fs::read(&path).unwrap()), [(1, 14), (2, 20), (3, 30)]);
+
+        // Compact once the deltas add up to more than the full snapshot
+        log.set_max_deltas(usize::MAX);
+        let mut val = 15;
+        loop {
+            let written = turn(&mut log, &[(1, val), (2, 20), (3, 30)]);
+            if written as u64 == fs::metadata(&path).unwrap().len() {
+                break;
+            }
+            val += 1;
+            assert!(val < 20);
+        }
+        assert!(val > 16);
+        assert_eq!(objects(&fs::read(&path).unwrap()), [(1, val), (2, 20), (3, 30)]);
+        fs::remove_file(&path).unwrap();
+    }
+}
@@ -9,15 +9,21 @@ https://github.com/curiousdannii/remglk-rs
 
 */
 
-use std::cmp::min;
+use std::cmp::{max, min};
+use std::io;
 
 use super::*;
 use constants::*;
+use blorb::ResourceStream;
+use file_streams::FileStream;
+use metrics::record;
+use pool::SharedBufferPool;
+use snapshot::*;
 
 const GLK_NULL: u32 = 0;
 
 pub trait Stream {
-    fn close(&self) -> StreamResult;
+    fn close(&mut self) -> StreamResult;
     fn disprock(&self) -> Option<u32>;
     fn get_buffer(&mut self, buf: &mut GlkArray) -> u32;
     fn get_char(&mut self, uni: bool) -> i32;
@@ -26,25 +32,76 @@ pub trait Stream {
     fn put_buffer(&mut self, buf: &GlkArray);
     fn put_char(&mut self, ch: u32);
     fn put_string(&mut self, str: &str, style: Option<&str>);
+    /** Write out any buffered output. Called for every open stream when a session sends its update */
+    fn flush(&mut self) {}
     fn rock(&self) -> u32;
     fn set_position(&mut self, mode: SeekMode, pos: i32);
 }
 
-/** A fixed-length TypedArray backed stream */
-pub struct ArrayBackedStream<'a> {
-    buf: &'a mut GlkArray<'a>,
+/** A fixed-length TypedArray backed stream
+ *
+ * Use `u8` for Latin-1 memory streams and `u32` for Unicode memory streams.
+ */
+pub struct ArrayBackedStream<'a, T: GlkElement> {
+    buf: &'a mut [T],
     close_cb: Option<fn()>,
     disprock: Option<u32>,
     fmode: FileMode,
-    len: usize,
     pos: usize,
     read_count: usize,
     rock: u32,
     write_count: usize,
 }
 
-impl Stream for ArrayBackedStream<'_> {
-    fn close(&self) -> StreamResult {
+impl<'a, T: GlkElement> ArrayBackedStream<'a, T> {
+    pub fn new(buf: &'a mut [T], fmode: FileMode, rock: u32, close_cb: Option<fn()>) -> Self {
+        ArrayBackedStream {
+            buf,
+            close_cb,
+            disprock: None,
+            fmode,
+            pos: 0,
+            read_count: 0,
+            rock,
+            write_count: 0,
+        }
+    }
+
+    /** Restore a stream saved by `snapshot`. The VM must give us back the same array */
+    pub fn from_snapshot(r: &mut SectionReader, buf: &'a mut [T], close_cb: Option<fn()>) -> io::Result<Self> {
+        let state = StreamState::read(r)?;
+        if r.bool()? != T::UNI || r.usize()? != buf.len() || state.pos > buf.len() {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "Memory stream snapshot doesn't match its array"));
+        }
+        Ok(ArrayBackedStream {
+            buf,
+            close_cb,
+            disprock: state.disprock,
+            fmode: state.fmode,
+            pos: state.pos,
+            read_count: state.read_count,
+            rock: state.rock,
+            write_count: state.write_count,
+        })
+    }
+
+    /** Save the stream's position and counts. The array itself belongs to the VM, so it isn't saved */
+    pub fn snapshot(&self, w: &mut SectionWriter) {
+        StreamState {
+            disprock: self.disprock,
+            fmode: self.fmode,
+            pos: self.pos,
+            read_count: self.read_count,
+            rock: self.rock,
+            write_count: self.write_count,
+        }.write(w);
+        w.bool(T::UNI);
+        w.usize(self.buf.len());
+    }
+}
+
+impl<T: GlkElement> Stream for ArrayBackedStream<'_, T> {
+    fn close(&mut self) -> StreamResult {
         if let Some(cb) = self.close_cb {
             cb();
         }
@@ -62,22 +119,23 @@ impl Stream for ArrayBackedStream<'_> {
         if let FileMode::Write | FileMode::WriteAppend = self.fmode {
             panic!("Cannot read from write-only stream")
         }
-        let read_length = min(buf.len(), self.len - self.pos);
-        buf.set_slice(self.buf, self.pos, 0, read_length);
+        let read_length = min(buf.len(), self.buf.len() - self.pos);
+        buf.set_slice(&T::as_array(self.buf), self.pos, 0, read_length);
         self.pos += read_length;
         self.read_count += read_length;
         read_length as u32
     }
 
+    #[inline]
     fn get_char(&mut self, uni: bool) -> i32 {
         if let FileMode::Write | FileMode::WriteAppend = self.fmode {
             panic!("Cannot read from write-only stream")
         }
         self.read_count += 1;
-        if self.pos < self.len {
-            let ch = self.buf.get_u32(self.pos);
+        if let Some(&ch) = self.buf.get(self.pos) {
             self.pos += 1;
-            return if !uni && ch > MAX_LATIN1 {QUESTION_MARK} else {ch} as i32;
+            let ch = ch.to_u32();
+            return if T::UNI && !uni && ch > MAX_LATIN1 {QUESTION_MARK} else {ch} as i32;
         }
         -1
     }
@@ -86,23 +144,22 @@ impl Stream for ArrayBackedStream<'_> {
         if let FileMode::Write | FileMode::WriteAppend = self.fmode {
             panic!("Cannot read from write-only stream")
         }
-        let read_length: isize = min(buf.len() as isize - 1, (self.len - self.pos) as isize);
+        let read_length: isize = min(buf.len() as isize - 1, (self.buf.len() - self.pos) as isize);
         if read_length < 0 {
             return 0;
         }
-        let mut i: usize = 0;
-        while i < read_length as usize {
-            let ch = self.buf.get_u32(self.pos);
-            self.pos += 1;
-            buf.set_u32(i, ch);
-            i += 1;
-            if ch == 10 {
-                break;
-            }
-        }
-        buf.set_u32(i, GLK_NULL);
-        self.read_count += i;
-        i as u32
+        let read_length = read_length as usize;
+        let src = T::as_array(self.buf);
+        // Copy up to and including the first newline in one go
+        let line_length = match src.find_newline(self.pos, self.pos + read_length) {
+            Some(newline) => newline - self.pos + 1,
+            None => read_length,
+        };
+        buf.set_slice(&src, self.pos, 0, line_length);
+        self.pos += line_length;
+        buf.set_u32(line_length, GLK_NULL);
+        self.read_count += line_length;
+        line_length as u32
     }
 
     fn get_position(&self) -> u32 {
@@ -114,18 +171,19 @@ impl Stream for ArrayBackedStream<'_> {
             panic!("Cannot write to read-only stream")
         }
         let buf_length = buf.len();
-        let write_length = min(buf_length, self.len - self.pos);
-        self.buf.set_slice(buf, 0, self.pos, write_length);
+        let write_length = min(buf_length, self.buf.len() - self.pos);
+        T::as_array(self.buf).set_slice(buf, 0, self.pos, write_length);
         self.pos += write_length;
         self.write_count += buf_length;
     }
 
+    #[inline]
     fn put_char(&mut self, ch: u32) {
         if let FileMode::Read = self.fmode {
             panic!("Cannot write to read-only stream")
         }
-        if self.pos < self.len {
-            self.buf.set_u32(self.pos, ch);
+        if let Some(dest) = self.buf.get_mut(self.pos) {
+            *dest = T::from_u32(ch);
             self.pos += 1;
         }
         self.write_count += 1;
@@ -135,7 +193,7 @@ impl Stream for ArrayBackedStream<'_> {
         if let FileMode::Read = self.fmode {
             panic!("Cannot write to read-only stream")
         }
-        let (str_length, write_length) = self.buf.set_str(self.pos, str);
+        let (str_length, write_length) = T::as_array(self.buf).set_str(self.pos, str);
         self.pos += write_length;
         self.write_count += str_length;
     }
@@ -145,11 +203,347 @@ impl Stream for ArrayBackedStream<'_> {
     }
 
     fn set_position(&mut self, mode: SeekMode, pos: i32) {
+        let len = self.buf.len() as i32;
         let new_pos: i32 = match mode {
             SeekMode::Current => self.pos as i32 + pos,
-            SeekMode::End => self.len as i32 + pos,
+            SeekMode::End => len + pos,
             SeekMode::Start => pos,
         };
-        self.pos = new_pos.clamp(0, self.len as i32) as usize;
+        self.pos = new_pos.clamp(0, len) as usize;
+    }
+}
+
+/** A growable memory stream, with its buffer drawn from a shared pool
+ *
+ * Writes past the end extend the stream. The buffer is returned to the pool when the stream is dropped.
+ */
+pub struct GrowableStream<T: GlkElement> {
+    buf: Vec<T>,
+    disprock: Option<u32>,
+    fmode: FileMode,
+    pool: SharedBufferPool<T>,
+    pos: usize,
+    read_count: usize,
+    rock: u32,
+    write_count: usize,
+}
+
+impl<T: GlkElement> GrowableStream<T> {
+    pub fn new(pool: SharedBufferPool<T>, data: &[T], fmode: FileMode, rock: u32) -> Self {
+        let mut buf = pool.lock().unwrap().acquire(data.len());
+        buf.extend_from_slice(data);
+        let pos = if let FileMode::WriteAppend = fmode {buf.len()} else {0};
+        GrowableStream {
+            buf,
+            disprock: None,
+            fmode,
+            pool,
+            pos,
+            read_count: 0,
+            rock,
+            write_count: 0,
+        }
+    }
+
+    /** The current contents of the stream */
+    pub fn data(&self) -> &[T] {
+        &self.buf
+    }
+
+    /** Restore a stream saved by `snapshot` */
+    pub fn from_snapshot(r: &mut SectionReader, pool: SharedBufferPool<T>) -> io::Result<Self> {
+        let state = StreamState::read(r)?;
+        if r.bool()? != T::UNI {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "Memory stream snapshot has the wrong character width"));
+        }
+        let data: Vec<T> = if T::UNI {
+            r.u32_slice()?.iter().map(|&ch| T::from_u32(ch)).collect()
+        }
+        else {
+            r.bytes()?.iter().map(|&ch| T::from_u32(ch as u32)).collect()
+        };
+        if state.pos > data.len() {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "Memory stream snapshot position is past the end of its data"));
+        }
+        let mut stream = GrowableStream::new(pool, &data, state.fmode, state.rock);
+        stream.disprock = state.disprock;
+        stream.pos = state.pos;
+        stream.read_count = state.read_count;
+        stream.write_count = state.write_count;
+        Ok(stream)
+    }
+
+    pub fn snapshot(&self, w: &mut SectionWriter) {
+        StreamState {
+            disprock: self.disprock,
+            fmode: self.fmode,
+            pos: self.pos,
+            read_count: self.read_count,
+            rock: self.rock,
+            write_count: self.write_count,
+        }.write(w);
+        w.bool(T::UNI);
+        if T::UNI {
+            let data: Vec<u32> = self.buf.iter().map(|ch| ch.to_u32()).collect();
+            w.u32_slice(&data);
+        }
+        else {
+            let data: Vec<u8> = self.buf.iter().map(|ch| ch.to_u32() as u8).collect();
+            w.bytes(&data);
+        }
+    }
+
+    /** Make the stream at least `len` long, swapping in a bigger pooled buffer if needed */
+    fn extend_to(&mut self, len: usize) {
+        if len > self.buf.capacity() {
+            let mut pool = self.pool.lock().unwrap();
+            let mut new_buf = pool.acquire(len);
+            new_buf.extend_from_slice(&self.buf);
+            pool.release(std::mem::replace(&mut self.buf, new_buf));
+        }
+        if len > self.buf.len() {
+            self.buf.resize(len, T::default());
+        }
+    }
+}
+
+impl<T: GlkElement> Drop for GrowableStream<T> {
+    fn drop(&mut self) {
+        if let Ok(mut pool) = self.pool.lock() {
+            pool.release(std::mem::take(&mut self.buf));
+        }
+    }
+}
+
+impl<T: GlkElement> Stream for GrowableStream<T> {
+    fn close(&mut self) -> StreamResult {
+        StreamResult {
+            read_count: self.read_count as u32,
+            write_count: self.write_count as u32,
+        }
+    }
+
+    fn disprock(&self) -> Option<u32> {
+        self.disprock
+    }
+
+    fn get_buffer(&mut self, buf: &mut GlkArray) -> u32 {
+        if let FileMode::Write | FileMode::WriteAppend = self.fmode {
+            panic!("Cannot read from write-only stream")
+        }
+        let read_length = min(buf.len(), self.buf.len() - self.pos);
+        buf.set_slice(&T::as_array(&mut self.buf), self.pos, 0, read_length);
+        self.pos += read_length;
+        self.read_count += read_length;
+        read_length as u32
+    }
+
+    #[inline]
+    fn get_char(&mut self, uni: bool) -> i32 {
+        if let FileMode::Write | FileMode::WriteAppend = self.fmode {
+            panic!("Cannot read from write-only stream")
+        }
+        self.read_count += 1;
+        if let Some(&ch) = self.buf.get(self.pos) {
+            self.pos += 1;
+            let ch = ch.to_u32();
+            return if T::UNI && !uni && ch > MAX_LATIN1 {QUESTION_MARK} else {ch} as i32;
+        }
+        -1
+    }
+
+    fn get_line(&mut self, buf: &mut GlkArray) -> u32 {
+        if let FileMode::Write | FileMode::WriteAppend = self.fmode {
+            panic!("Cannot read from write-only stream")
+        }
+        let read_length: isize = min(buf.len() as isize - 1, (self.buf.len() - self.pos) as isize);
+        if read_length < 0 {
+            return 0;
+        }
+        let read_length = read_length as usize;
+        let src = T::as_array(&mut self.buf);
+        let line_length = match src.find_newline(self.pos, self.pos + read_length) {
+            Some(newline) => newline - self.pos + 1,
+            None => read_length,
+        };
+        buf.set_slice(&src, self.pos, 0, line_length);
+        self.pos += line_length;
+        buf.set_u32(line_length, GLK_NULL);
+        self.read_count += line_length;
+        line_length as u32
     }
-}
\ No newline at end of file
+
+    fn get_position(&self) -> u32 {
+        self.pos as u32
+    }
+
+    fn put_buffer(&mut self, buf: &GlkArray) {
+        if let FileMode::Read = self.fmode {
+            panic!("Cannot write to read-only stream")
+        }
+        let buf_length = buf.len();
+        self.extend_to(self.pos + buf_length);
+        T::as_array(&mut self.buf).set_slice(buf, 0, self.pos, buf_length);
+        self.pos += buf_length;
+        self.write_count += buf_length;
+    }
+
+    #[inline]
+    fn put_char(&mut self, ch: u32) {
+        if let FileMode::Read = self.fmode {
+            panic!("Cannot write to read-only stream")
+        }
+        let ch = T::from_u32(ch);
+        if let Some(dest) = self.buf.get_mut(self.pos) {
+            *dest = ch;
+        }
+        else {
+            self.extend_to(self.pos + 1);
+            self.buf[self.pos] = ch;
+        }
+        self.pos += 1;
+        self.write_count += 1;
+    }
+
+    fn put_string(&mut self, str: &str, _style: Option<&str>) {
+        if let FileMode::Read = self.fmode {
+            panic!("Cannot write to read-only stream")
+        }
+        // The byte length is an upper bound on the number of characters
+        let old_len = self.buf.len();
+        self.extend_to(self.pos + str.len());
+        let (str_length, write_length) = T::as_array(&mut self.buf).set_str(self.pos, str);
+        self.pos += write_length;
+        self.buf.truncate(max(old_len, self.pos));
+        self.write_count += str_length;
+    }
+
+    fn rock(&self) -> u32 {
+        self.rock
+    }
+
+    fn set_position(&mut self, mode: SeekMode, pos: i32) {
+        let len = self.buf.len() as i32;
+        let new_pos: i32 = match mode {
+            SeekMode::Current => self.pos as i32 + pos,
+            SeekMode::End => len + pos,
+            SeekMode::Start => pos,
+        };
+        self.pos = new_pos.clamp(0, len) as usize;
+    }
+}
+
+/** Any kind of stream, so that streams can be stored together without boxing */
+pub enum GlkStream<'a> {
+    ArrayU8(ArrayBackedStream<'a, u8>),
+    ArrayU32(ArrayBackedStream<'a, u32>),
+    File(FileStream),
+    GrowableU8(GrowableStream<u8>),
+    GrowableU32(GrowableStream<u32>),
+    Resource(ResourceStream),
+}
+
+macro_rules! dispatch {
+    ($self:ident, $stream:ident => $call:expr) => {
+        match $self {
+            GlkStream::ArrayU8($stream) => $call,
+            GlkStream::ArrayU32($stream) => $call,
+            GlkStream::File($stream) => $call,
+            GlkStream::GrowableU8($stream) => $call,
+            GlkStream::GrowableU32($stream) => $call,
+            GlkStream::Resource($stream) => $call,
+        }
+    };
+}
+
+impl Stream for GlkStream<'_> {
+    // Without the metrics feature `record!` expands to nothing, leaving a bare let and return
+    #[allow(clippy::let_and_return)]
+    fn close(&mut self) -> StreamResult {
+        let result = dispatch!(self, stream => stream.close());
+        record!(stream_read_count += result.read_count as u64);
+        record!(stream_write_count += result.write_count as u64);
+        result
+    }
+
+    fn disprock(&self) -> Option<u32> {
+        dispatch!(self, stream => stream.disprock())
+    }
+
+    fn get_buffer(&mut self, buf: &mut GlkArray) -> u32 {
+        dispatch!(self, stream => stream.get_buffer(buf))
+    }
+
+    fn get_char(&mut self, uni: bool) -> i32 {
+        dispatch!(self, stream => stream.get_char(uni))
+    }
+
+    fn get_line(&mut self, buf: &mut GlkArray) -> u32 {
+        dispatch!(self, stream => stream.get_line(buf))
+    }
+
+    fn get_position(&self) -> u32 {
+        dispatch!(self, stream => stream.get_position())
+    }
+
+    fn put_buffer(&mut self, buf: &GlkArray) {
+        record!(put_buffer_calls += 1);
+        record!(put_buffer_chars += buf.len() as u64);
+        dispatch!(self, stream => stream.put_buffer(buf))
+    }
+
+    fn put_char(&mut self, ch: u32) {
+        record!(put_char_calls += 1);
+        dispatch!(self, stream => stream.put_char(ch))
+    }
+
+    fn put_string(&mut self, str: &str, style: Option<&str>) {
+        record!(put_string_calls += 1);
+        record!(put_string_bytes += str.len() as u64);
+        dispatch!(self, stream => stream.put_string(str, style))
+    }
+
+    fn flush(&mut self) {
+        dispatch!(self, stream => stream.flush())
+    }
+
+    fn rock(&self) -> u32 {
+        dispatch!(self, stream => stream.rock())
+    }
+
+    fn set_position(&mut self, mode: SeekMode, pos: i32) {
+        dispatch!(self, stream => stream.set_position(mode, pos))
+    }
+}
+
+/** The state every stream type saves in its snapshot */
+pub(crate) struct StreamState {
+    pub disprock: Option<u32>,
+    pub fmode: FileMode,
+    pub pos: usize,
+    pub read_count: usize,
+    pub rock: u32,
+    pub write_count: usize,
+}
+
+impl StreamState {
+    pub fn read(r: &mut SectionReader) -> io::Result<Self> {
+        Ok(StreamState {
+            disprock: r.opt_u32()?,
+            fmode: FileMode::from_glk(r.u32()?).ok_or_else(|| io::Error::new(io::ErrorKind::InvalidData, "Unknown file mode in snapshot"))?,
+            pos: r.usize()?,
+            read_count: r.usize()?,
+            rock: r.u32()?,
+            write_count: r.usize()?,
+        })
+    }
+
+    pub fn write(&self, w: &mut SectionWriter) {
+        w.opt_u32(self.disprock);
+        w.u32(self.fmode as u32);
+        w.usize(self.pos);
+        w.usize(self.read_count);
+        w.u32(self.rock);
+        w.usize(self.write_count);
+    }
+}
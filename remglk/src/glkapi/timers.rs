@@ -0,0 +1,172 @@
+/*
+
+Timer wheel
+===========
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::sync::{Arc, Condvar, Mutex};
+use std::thread::{self, JoinHandle};
+use std::time::{Duration, Instant};
+
+const TICK: Duration = Duration::from_millis(10);
+const TICK_MS: u32 = 10;
+const SLOTS: usize = 256;
+
+/** Repeating timers for any number of sessions, run by a single thread
+ *
+ * Timers are hashed into a ring of slots by when they are next due, one slot per 10ms tick, with a count of how many more times round the ring they must wait. Each tick only looks at one slot, so adding, firing and rescheduling timers are all O(1). The thread sleeps while there are no timers.
+ */
+pub struct TimerWheel {
+    shared: Arc<WheelShared>,
+    thread: Option<JoinHandle<()>>,
+}
+
+struct WheelShared {
+    state: Mutex<WheelState>,
+    wake: Condvar,
+}
+
+struct WheelState {
+    count: usize,
+    current: usize,
+    next_tick: Instant,
+    shutdown: bool,
+    slots: Vec<Vec<Timer>>,
+}
+
+struct Timer {
+    callback: Box<dyn FnMut() -> bool + Send>,
+    /** Interval in ticks */
+    interval: u32,
+    /** How many more times round the ring before this timer is due */
+    rounds: u32,
+}
+
+impl TimerWheel {
+    pub fn new() -> Self {
+        let shared = Arc::new(WheelShared {
+            state: Mutex::new(WheelState {
+                count: 0,
+                current: 0,
+                next_tick: Instant::now(),
+                shutdown: false,
+                slots: (0..SLOTS).map(|_| Vec::new()).collect(),
+            }),
+            wake: Condvar::new(),
+        });
+        let thread = {
+            let shared = shared.clone();
+            thread::Builder::new()
+                .name("remglk-timers".to_string())
+                .spawn(move || shared.run())
+                .expect("Could not start timer thread")
+        };
+        TimerWheel {
+            shared,
+            thread: Some(thread),
+        }
+    }
+
+    /** Call `callback` every `interval` ms (rounded up to the 10ms tick) until it returns false
+     *
+     * Callbacks are run on the timer thread, so they should only queue an event and return.
+     */
+    pub fn schedule(&self, interval: u32, callback: impl FnMut() -> bool + Send + 'static) {
+        let mut state = self.shared.state.lock().unwrap();
+        if state.count == 0 {
+            state.next_tick = Instant::now() + TICK;
+        }
+        state.count += 1;
+        state.insert(Timer {
+            callback: Box::new(callback),
+            interval: interval.div_ceil(TICK_MS).max(1),
+            rounds: 0,
+        });
+        drop(state);
+        self.shared.wake.notify_one();
+    }
+
+    /** How many timers are running */
+    pub fn len(&self) -> usize {
+        self.shared.state.lock().unwrap().count
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+impl Default for TimerWheel {
+    fn default() -> Self {
+        TimerWheel::new()
+    }
+}
+
+impl Drop for TimerWheel {
+    fn drop(&mut self) {
+        self.shared.state.lock().unwrap().shutdown = true;
+        self.shared.wake.notify_one();
+        if let Some(thread) = self.thread.take() {
+            let _ = thread.join();
+        }
+    }
+}
+
+impl WheelState {
+    fn insert(&mut self, mut timer: Timer) {
+        let ticks = timer.interval as usize;
+        timer.rounds = ((ticks - 1) / SLOTS) as u32;
+        self.slots[(self.current + ticks) % SLOTS].push(timer);
+    }
+}
+
+impl WheelShared {
+    fn run(&self) {
+        let mut state = self.state.lock().unwrap();
+        loop {
+            if state.shutdown {
+                return;
+            }
+            if state.count == 0 {
+                state = self.wake.wait(state).unwrap();
+                continue;
+            }
+            let now = Instant::now();
+            if now < state.next_tick {
+                let timeout = state.next_tick - now;
+                state = self.wake.wait_timeout(state, timeout).unwrap().0;
+                continue;
+            }
+            state.next_tick += TICK;
+            state.current = (state.current + 1) % SLOTS;
+            let current = state.current;
+            let mut due = Vec::new();
+            for mut timer in std::mem::take(&mut state.slots[current]) {
+                if timer.rounds > 0 {
+                    timer.rounds -= 1;
+                    state.slots[current].push(timer);
+                }
+                else {
+                    due.push(timer);
+                }
+            }
+            if due.is_empty() {
+                continue;
+            }
+            drop(state);
+            // Callbacks run unlocked so that they may schedule more timers
+            let fired = due.len();
+            due.retain_mut(|timer| (timer.callback)());
+            state = self.state.lock().unwrap();
+            state.count -= fired - due.len();
+            for timer in due {
+                state.insert(timer);
+            }
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/*
+
+Protocol transports
+===================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::io::{self, BufRead, ErrorKind, Write};
+
+use super::deserialise::{DeserialiseError, Result};
+use super::json::{self, JsonWriter};
+use super::msgpack::{self, MessagePackWriter};
+use super::protocol::{Event, InitEvent};
+use super::serialise::Serialise;
+
+/** The `support` capability a client sends in its init event to ask for MessagePack */
+pub const MSGPACK_SUPPORT: &str = "msgpack";
+
+/** Frames bigger than this are rejected rather than allocated */
+const MAX_FRAME_LENGTH: usize = 64 << 20;
+
+/** How protocol messages are encoded
+ *
+ * Every session starts with newline delimited JSON. If the init event lists `MSGPACK_SUPPORT`, all later messages in both directions, beginning with the reply to the init event, are MessagePack, each preceded by its length as a little endian u32.
+ */
+#[derive(Clone, Copy, Debug, Default, Eq, PartialEq)]
+pub enum Transport {
+    #[default]
+    Json,
+    MessagePack,
+}
+
+impl Transport {
+    /** Choose the transport for the rest of the session */
+    pub fn negotiate(init: &InitEvent) -> Transport {
+        if init.support.iter().any(|support| support == MSGPACK_SUPPORT) {
+            Transport::MessagePack
+        }
+        else {
+            Transport::Json
+        }
+    }
+
+    /** Parse one event from a message read by `read_message` */
+    pub fn parse_event<'a>(&self, data: &'a [u8]) -> Result<Event<'a>> {
+        match self {
+            Transport::Json => {
+                let json = std::str::from_utf8(data).map_err(|err| DeserialiseError {
+                    offset: err.valid_up_to(),
+                    reason: "Invalid UTF-8 in JSON",
+                })?;
+                json::parse_event(json)
+            },
+            Transport::MessagePack => msgpack::parse_event(data),
+        }
+    }
+
+    /** Read one message into `buf`, returning false at the end of the input */
+    pub fn read_message<R: BufRead>(&self, input: &mut R, buf: &mut Vec<u8>) -> io::Result<bool> {
+        buf.clear();
+        match self {
+            Transport::Json => {
+                // Skip blank lines between messages
+                while buf.is_empty() {
+                    if input.read_until(b'\n', buf)? == 0 {
+                        return Ok(false);
+                    }
+                    let len = buf.trim_ascii_end().len();
+                    buf.truncate(len);
+                }
+            },
+            Transport::MessagePack => {
+                // Only an end of input before the first byte of the length is a clean end
+                let mut len = [0; 4];
+                let mut filled = 0;
+                while filled < len.len() {
+                    match input.read(&mut len[filled..]) {
+                        Ok(0) if filled == 0 => return Ok(false),
+                        Ok(0) => return Err(io::Error::new(ErrorKind::InvalidData, "Truncated MessagePack frame length")),
+                        Ok(n) => filled += n,
+                        Err(err) if err.kind() == ErrorKind::Interrupted => {},
+                        Err(err) => return Err(err),
+                    }
+                }
+                let len = u32::from_le_bytes(len) as usize;
+                if len > MAX_FRAME_LENGTH {
+                    return Err(io::Error::new(ErrorKind::InvalidData, "MessagePack frame too long"));
+                }
+                buf.resize(len, 0);
+                input.read_exact(buf)?;
+            },
+        }
+        Ok(true)
+    }
+}
+
+/** A reusable writer for whichever transport was negotiated */
+pub enum TransportWriter {
+    Json(JsonWriter),
+    MessagePack(MessagePackWriter),
+}
+
+impl TransportWriter {
+    pub fn new(transport: Transport) -> Self {
+        match transport {
+            Transport::Json => TransportWriter::Json(JsonWriter::new()),
+            Transport::MessagePack => TransportWriter::MessagePack(MessagePackWriter::new()),
+        }
+    }
+
+    pub fn transport(&self) -> Transport {
+        match self {
+            TransportWriter::Json(_) => Transport::Json,
+            TransportWriter::MessagePack(_) => Transport::MessagePack,
+        }
+    }
+
+    /** Serialise a value, replacing whatever was in the buffer */
+    pub fn write<T: Serialise + ?Sized>(&mut self, val: &T) -> &[u8] {
+        match self {
+            TransportWriter::Json(writer) => writer.write(val),
+            TransportWriter::MessagePack(writer) => writer.write(val),
+        }
+    }
+
+    /** Write the buffer out framed for this transport */
+    pub fn write_to<W: Write>(&self, output: &mut W) -> io::Result<()> {
+        match self {
+            TransportWriter::Json(writer) => writer.write_to(output),
+            TransportWriter::MessagePack(writer) => writer.write_to(output),
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn messagepack_framing() {
+        let mut buf = Vec::new();
+        let mut input: &[u8] = &[2, 0, 0, 0, 0xC0, 0xC0, 1, 0, 0, 0, 0xC3];
+        assert!(Transport::MessagePack.read_message(&mut input, &mut buf).unwrap());
+        assert_eq!(buf, [0xC0, 0xC0]);
+        assert!(Transport::MessagePack.read_message(&mut input, &mut buf).unwrap());
+        assert_eq!(buf, [0xC3]);
+        assert!(!Transport::MessagePack.read_message(&mut input, &mut buf).unwrap());
+
+        // A cut off length or body is an error, not the end of the input
+        for len in 1..4 {
+            let mut input: &[u8] = &[2, 0, 0, 0][..len];
+            assert_eq!(Transport::MessagePack.read_message(&mut input, &mut buf).unwrap_err().kind(), ErrorKind::InvalidData);
+        }
+        let mut input: &[u8] = &[2, 0, 0, 0, 0xC0];
+        assert!(Transport::MessagePack.read_message(&mut input, &mut buf).is_err());
+    }
+}
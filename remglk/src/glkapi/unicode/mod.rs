@@ -0,0 +1,341 @@
+/*
+
+Unicode case mapping and normalisation
+======================================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+/*
+
+The character data comes from two level tables generated by scripts/unicode_tables.py: a character's high bits index a table of deduplicated blocks, and its low bits index into the block. Most blocks are shared, so the case tables come to under 20KB and the parts used by typical text stay in cache.
+
+Strings of Latin-1 characters are handled without looking at the tables at all, and nothing allocates except normalising text which actually has something to normalise.
+
+*/
+
+mod tables;
+
+use tables::*;
+use super::simd;
+
+const HANGUL_END: u32 = HANGUL_START + 11172;
+const HANGUL_START: u32 = 0xAC00;
+const JAMO_L_START: u32 = 0x1100;
+const JAMO_T_START: u32 = 0x11A7;
+const JAMO_V_START: u32 = 0x1161;
+const JAMO_L_COUNT: u32 = 19;
+const JAMO_T_COUNT: u32 = 28;
+const JAMO_V_COUNT: u32 = 21;
+
+/** Below this nothing has a decomposition */
+const FIRST_DECOMPOSABLE: u32 = 0xC0;
+/** Below this everything is already in NFC, and nothing composes with anything that came before it */
+const FIRST_COMPOSING: u32 = 0x300;
+
+#[inline]
+fn lookup<T: Copy + Default>(ch: u32, limit: u32, index: &[u16], blocks: &[T]) -> T {
+    if ch >= limit {
+        return T::default();
+    }
+    blocks[(index[(ch >> SHIFT) as usize] as usize) << SHIFT | (ch as usize & ((1 << SHIFT) - 1))]
+}
+
+#[derive(Clone, Copy)]
+enum Case {
+    Lower = 0,
+    Upper = 1,
+    Title = 2,
+}
+
+/** A character's case mapping, which may be more than one character */
+enum Mapped {
+    Char(u32),
+    Chars(&'static [u32]),
+}
+
+impl Mapped {
+    fn len(&self) -> usize {
+        match self {
+            Mapped::Char(_) => 1,
+            Mapped::Chars(chars) => chars.len(),
+        }
+    }
+}
+
+fn map_case(ch: u32, case: Option<Case>) -> Mapped {
+    let case = match case {
+        Some(case) => case,
+        None => return Mapped::Char(ch),
+    };
+    let record = CASE_RECORDS[lookup(ch, CASE_LIMIT, &CASE_INDEX, &CASE_BLOCKS) as usize];
+    let val = record[case as usize];
+    if val >= MULTI {
+        let i = (val - MULTI) as usize;
+        let len = CASE_SEQUENCES[i] as usize;
+        Mapped::Chars(&CASE_SEQUENCES[i + 1..i + 1 + len])
+    }
+    else {
+        Mapped::Char((ch as i32 + val) as u32)
+    }
+}
+
+/** Change the case of the first `numchars` characters in place
+ *
+ * Characters are changed one by one until one maps to several characters, after which the rest are written backwards from where the result will end. Results which don't fit are cut off, but the full length is returned.
+ */
+fn change_case(buf: &mut [u32], numchars: usize, case_at: impl Fn(usize) -> Option<Case>) -> usize {
+    for i in 0..numchars {
+        match map_case(buf[i], case_at(i)) {
+            Mapped::Char(ch) => buf[i] = ch,
+            Mapped::Chars(_) => return expand_case(buf, numchars, i, case_at),
+        }
+    }
+    numchars
+}
+
+fn expand_case(buf: &mut [u32], numchars: usize, start: usize, case_at: impl Fn(usize) -> Option<Case>) -> usize {
+    let total = start + (start..numchars).map(|i| map_case(buf[i], case_at(i)).len()).sum::<usize>();
+    // Each character's result starts at or after where it was, so this never overwrites characters still to be read
+    let mut end = total;
+    for i in (start..numchars).rev() {
+        match map_case(buf[i], case_at(i)) {
+            Mapped::Char(ch) => write_before(buf, &mut end, ch),
+            Mapped::Chars(chars) => chars.iter().rev().for_each(|&ch| write_before(buf, &mut end, ch)),
+        }
+    }
+    total
+}
+
+/** Write a character just before `end`, if it is within the buffer */
+#[inline]
+fn write_before(buf: &mut [u32], end: &mut usize, ch: u32) {
+    *end -= 1;
+    if *end < buf.len() {
+        buf[*end] = ch;
+    }
+}
+
+/** Lower case the first `numchars` characters of a buffer, returning the length of the result */
+pub fn buffer_to_lower_case(buf: &mut [u32], numchars: usize) -> usize {
+    let numchars = numchars.min(buf.len());
+    let done = simd::change_case_latin1(&mut buf[..numchars], false);
+    done + change_case(&mut buf[done..], numchars - done, |_| Some(Case::Lower))
+}
+
+/** Upper case the first `numchars` characters of a buffer, returning the length of the result */
+pub fn buffer_to_upper_case(buf: &mut [u32], numchars: usize) -> usize {
+    let numchars = numchars.min(buf.len());
+    let done = simd::change_case_latin1(&mut buf[..numchars], true);
+    done + change_case(&mut buf[done..], numchars - done, |_| Some(Case::Upper))
+}
+
+/** Title case the first character of a buffer, and lower case the rest if `lowerrest` is set, returning the length of the result */
+pub fn buffer_to_title_case(buf: &mut [u32], numchars: usize, lowerrest: bool) -> usize {
+    let numchars = numchars.min(buf.len());
+    if numchars == 0 {
+        return 0;
+    }
+    if let Mapped::Char(ch) = map_case(buf[0], Some(Case::Title)) {
+        buf[0] = ch;
+        return if lowerrest {1 + buffer_to_lower_case(&mut buf[1..], numchars - 1)} else {numchars};
+    }
+    change_case(buf, numchars, |i| if i == 0 {Some(Case::Title)} else if lowerrest {Some(Case::Lower)} else {None})
+}
+
+fn combining_class(ch: u32) -> u8 {
+    lookup(ch, COMBINING_CLASS_LIMIT, &COMBINING_CLASS_INDEX, &COMBINING_CLASS_BLOCKS)
+}
+
+/** Append the full canonical decomposition of some characters, in canonical order */
+fn decompose(chars: &[u32], out: &mut Vec<u32>) {
+    for &ch in chars {
+        if (HANGUL_START..HANGUL_END).contains(&ch) {
+            let index = ch - HANGUL_START;
+            out.push(JAMO_L_START + index / (JAMO_V_COUNT * JAMO_T_COUNT));
+            out.push(JAMO_V_START + index % (JAMO_V_COUNT * JAMO_T_COUNT) / JAMO_T_COUNT);
+            if index % JAMO_T_COUNT != 0 {
+                out.push(JAMO_T_START + index % JAMO_T_COUNT);
+            }
+            continue;
+        }
+        match lookup(ch, DECOMPOSITION_LIMIT, &DECOMPOSITION_INDEX, &DECOMPOSITION_BLOCKS) as usize {
+            0 => out.push(ch),
+            i => {
+                let len = DECOMPOSITION_SEQUENCES[i] as usize;
+                out.extend_from_slice(&DECOMPOSITION_SEQUENCES[i + 1..i + 1 + len]);
+            },
+        }
+    }
+    // Sort each run of non-starters by combining class, keeping characters of the same class in order
+    for i in 1..out.len() {
+        let class = combining_class(out[i]);
+        if class == 0 {
+            continue;
+        }
+        let mut j = i;
+        while j > 0 && combining_class(out[j - 1]) > class {
+            out.swap(j - 1, j);
+            j -= 1;
+        }
+    }
+}
+
+fn compose_pair(first: u32, second: u32) -> Option<u32> {
+    if (JAMO_L_START..JAMO_L_START + JAMO_L_COUNT).contains(&first) && (JAMO_V_START..JAMO_V_START + JAMO_V_COUNT).contains(&second) {
+        return Some(HANGUL_START + ((first - JAMO_L_START) * JAMO_V_COUNT + second - JAMO_V_START) * JAMO_T_COUNT);
+    }
+    if (HANGUL_START..HANGUL_END).contains(&first) && (first - HANGUL_START) % JAMO_T_COUNT == 0 && (JAMO_T_START + 1..JAMO_T_START + JAMO_T_COUNT).contains(&second) {
+        return Some(first + second - JAMO_T_START);
+    }
+    COMPOSITIONS.binary_search_by(|&(a, b, _)| (a, b).cmp(&(first, second))).ok().map(|i| COMPOSITIONS[i].2)
+}
+
+/** Canonically compose decomposed characters in place */
+fn compose(chars: &mut Vec<u32>) {
+    let mut starter: Option<usize> = None;
+    let mut last_class = 0;
+    let mut len = 0;
+    for i in 0..chars.len() {
+        let ch = chars[i];
+        let class = combining_class(ch);
+        if let Some(starter) = starter {
+            // Characters are in canonical order, so only the last one kept can block this one
+            let blocked = len - 1 != starter && last_class >= class;
+            if !blocked {
+                if let Some(composed) = compose_pair(chars[starter], ch) {
+                    chars[starter] = composed;
+                    continue;
+                }
+            }
+        }
+        if class == 0 {
+            starter = Some(len);
+        }
+        last_class = class;
+        chars[len] = ch;
+        len += 1;
+    }
+    chars.truncate(len);
+}
+
+/** Put normalised characters back into a buffer from `start`, returning the length of the result */
+fn write_back(buf: &mut [u32], start: usize, chars: &[u32]) -> usize {
+    let fits = chars.len().min(buf.len() - start);
+    buf[start..start + fits].copy_from_slice(&chars[..fits]);
+    start + chars.len()
+}
+
+/** Convert the first `numchars` characters of a buffer to Normalisation Form D, returning the length of the result */
+pub fn buffer_canon_decompose(buf: &mut [u32], numchars: usize) -> usize {
+    let numchars = numchars.min(buf.len());
+    if simd::all_below(&buf[..numchars], FIRST_DECOMPOSABLE) {
+        return numchars;
+    }
+    // Everything before the first character which could decompose is a starter, so is left alone
+    let start = buf[..numchars].iter().position(|&ch| ch >= FIRST_DECOMPOSABLE).unwrap();
+    let mut chars = Vec::with_capacity((numchars - start) * 2);
+    decompose(&buf[start..numchars], &mut chars);
+    write_back(buf, start, &chars)
+}
+
+/** Convert the first `numchars` characters of a buffer to Normalisation Form C, returning the length of the result */
+pub fn buffer_canon_normalize(buf: &mut [u32], numchars: usize) -> usize {
+    let numchars = numchars.min(buf.len());
+    if simd::all_below(&buf[..numchars], FIRST_COMPOSING) {
+        return numchars;
+    }
+    // The character before the first one which could compose with something may be composed with it
+    let start = buf[..numchars].iter().position(|&ch| ch >= FIRST_COMPOSING).unwrap().saturating_sub(1);
+    let mut chars = Vec::with_capacity((numchars - start) * 2);
+    decompose(&buf[start..numchars], &mut chars);
+    compose(&mut chars);
+    write_back(buf, start, &chars)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn normalize(chars: &[u32]) -> Vec<u32> {
+        let mut buf = chars.to_vec();
+        buf.resize(chars.len() * 4, 0);
+        let len = buffer_canon_normalize(&mut buf, chars.len());
+        buf.truncate(len);
+        buf
+    }
+
+    #[test]
+    fn hangul() {
+        // L + V + T, and a precomposed LV + T
+        assert_eq!(normalize(&[0x1100, 0x1161, 0x11A8]), [0xAC01]);
+        assert_eq!(normalize(&[0xAC00, 0x11A8]), [0xAC01]);
+        // An LVT syllable can't take another T
+        assert_eq!(normalize(&[0xAC01, 0x11A8]), [0xAC01, 0x11A8]);
+        let mut buf = [0xAC01, 0, 0];
+        assert_eq!(buffer_canon_decompose(&mut buf, 1), 3);
+        assert_eq!(buf, [0x1100, 0x1161, 0x11A8]);
+    }
+
+    #[test]
+    fn blocked_composition() {
+        // The overline has the same combining class as the acute, so blocks it from composing with the a
+        assert_eq!(normalize(&[0x61, 0x305, 0x301]), [0x61, 0x305, 0x301]);
+        // Marks of different classes don't block each other, whichever order they come in
+        assert_eq!(normalize(&[0x61, 0x323, 0x302]), [0x1EAD]);
+        assert_eq!(normalize(&[0x61, 0x302, 0x323]), [0x1EAD]);
+        // A starter blocks everything after it
+        assert_eq!(normalize(&[0x61, 0x62, 0x301]), [0x61, 0x62, 0x301]);
+    }
+
+    #[test]
+    fn expanding_case() {
+        // ß upper cases to SS, which is cut off at the end of the buffer, but the full length is returned
+        let mut buf = [0x73, 0xDF, 0x78];
+        assert_eq!(buffer_to_upper_case(&mut buf, 3), 4);
+        assert_eq!(buf, [0x53, 0x53, 0x53]);
+        let mut buf = [0x61, 0xDF];
+        assert_eq!(buffer_to_upper_case(&mut buf, 2), 3);
+        assert_eq!(buf, [0x41, 0x53]);
+        let mut buf = [0x61, 0xDF, 0, 0];
+        assert_eq!(buffer_to_upper_case(&mut buf, 2), 3);
+        assert_eq!(buf, [0x41, 0x53, 0x53, 0]);
+        let mut buf = [0xDF, 0x41, 0];
+        assert_eq!(buffer_to_title_case(&mut buf, 2, true), 3);
+        assert_eq!(buf, [0x53, 0x73, 0x61]);
+    }
+
+    #[test]
+    fn latin1_fast_path() {
+        // Put each character which stops the fast path (and one beyond Latin-1) at every position of a SIMD vector and the scalar tail
+        let all: Vec<u32> = (0..0x100).collect();
+        let mut inputs = vec![all.clone(), all.iter().rev().copied().collect()];
+        for special in [0xB5, 0xDF, 0xFF, 0x100] {
+            for pos in 0..11 {
+                let mut chars: Vec<u32> = (0..11).map(|i| 0x41 + i * 3).collect();
+                chars[pos] = special;
+                inputs.push(chars);
+            }
+        }
+        for chars in inputs {
+            for upper in [false, true] {
+                let mut simd = chars.clone();
+                let mut scalar = chars.clone();
+                assert_eq!(simd::change_case_latin1(&mut simd, upper), simd::change_case_latin1_scalar(&mut scalar, upper));
+                assert_eq!(simd, scalar);
+                // And the whole conversion against the tables alone
+                let mut fast = chars.clone();
+                let mut tables = chars.clone();
+                tables.resize(chars.len() * 3, 0);
+                fast.resize(chars.len() * 3, 0);
+                let case = if upper {Case::Upper} else {Case::Lower};
+                let len = if upper {buffer_to_upper_case(&mut fast, chars.len())} else {buffer_to_lower_case(&mut fast, chars.len())};
+                assert_eq!(len, change_case(&mut tables, chars.len(), |_| Some(case)));
+                assert_eq!(fast, tables);
+            }
+        }
+    }
+}
@@ -0,0 +1,3351 @@
+/*
+
+Unicode tables
+==============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+Generated by remglk/scripts/unicode_tables.py from Unicode 14.0.0. Do not edit!
+
+*/
+
+pub const SHIFT: u32 = 7;
+pub const MULTI: i32 = 0x40000000;
+
+pub const CASE_LIMIT: u32 = 0x1E980;
+pub static CASE_INDEX: [u16; 979] = [
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 13, 12, 12, 12, 12, 12, 14, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 15, 16, 17, 18, 19, 20, 21,
+    12, 12, 22, 23, 12, 12, 12, 12, 12, 24, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 25, 26, 27, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 28, 29, 30, 31,
+    12, 12, 12, 12, 12, 12, 32, 33, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 34, 12, 12, 12, 12, 12, 12, 12, 35, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 36, 37, 38, 39, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 40, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 41, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 42, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 43,
+];
+pub static CASE_BLOCKS: [u16; 5632] = [
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 5,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    8, 9, 6, 7, 6, 7, 6, 7, 0, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 10, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 11, 6, 7, 6, 7, 6, 7, 12,
+    13, 14, 6, 7, 6, 7, 15, 6, 7, 16, 16, 6, 7, 0, 17, 18,
+    19, 6, 7, 16, 20, 21, 22, 23, 6, 7, 24, 0, 22, 25, 26, 27,
+    6, 7, 6, 7, 6, 7, 28, 6, 7, 28, 0, 0, 6, 7, 28, 6,
+    7, 29, 29, 6, 7, 6, 7, 30, 6, 7, 0, 0, 6, 7, 0, 31,
+    0, 0, 0, 0, 32, 33, 34, 32, 33, 34, 32, 33, 34, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 35, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    36, 32, 33, 34, 6, 7, 37, 38, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    39, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 40, 6, 7, 41, 42, 43,
+    43, 6, 7, 44, 45, 46, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    47, 48, 49, 50, 51, 0, 52, 52, 0, 53, 0, 54, 55, 0, 0, 0,
+    52, 56, 0, 57, 0, 58, 59, 0, 60, 61, 59, 62, 63, 0, 0, 61,
+    0, 64, 65, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0,
+    68, 0, 69, 68, 0, 0, 0, 70, 68, 71, 72, 72, 73, 0, 0, 0,
+    0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 7, 6, 7, 0, 0, 6, 7, 0, 0, 0, 26, 26, 26, 0, 78,
+    0, 0, 0, 0, 0, 0, 79, 0, 80, 80, 80, 0, 81, 0, 82, 82,
+    83, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 84, 85, 85, 85,
+    86, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 87, 2, 2, 2, 2, 2, 2, 2, 2, 2, 88, 89, 89, 90,
+    91, 92, 0, 0, 0, 93, 94, 95, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    96, 97, 98, 99, 100, 101, 0, 6, 7, 102, 6, 7, 0, 39, 39, 39,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    104, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 105,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    0, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 108, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+    109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+    109, 109, 109, 109, 109, 109, 0, 109, 0, 0, 0, 0, 0, 109, 0, 0,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 0, 0, 110, 110, 110,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    90, 90, 90, 90, 90, 90, 0, 0, 95, 95, 95, 95, 95, 95, 0, 0,
+    112, 113, 114, 115, 115, 116, 117, 118, 119, 0, 0, 0, 0, 0, 0, 0,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 0, 0, 120, 120, 120,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 0, 0, 0, 122, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 124, 125, 126, 127, 128, 129, 0, 0, 130, 0,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132,
+    131, 131, 131, 131, 131, 131, 0, 0, 132, 132, 132, 132, 132, 132, 0, 0,
+    131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132,
+    131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132,
+    131, 131, 131, 131, 131, 131, 0, 0, 132, 132, 132, 132, 132, 132, 0, 0,
+    133, 131, 134, 131, 135, 131, 136, 131, 0, 132, 0, 132, 0, 132, 0, 132,
+    131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132,
+    137, 137, 138, 138, 138, 138, 139, 139, 140, 140, 141, 141, 142, 142, 0, 0,
+    143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+    159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+    175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+    131, 131, 191, 192, 193, 0, 194, 195, 132, 132, 196, 196, 197, 0, 198, 0,
+    0, 0, 199, 200, 201, 0, 202, 203, 204, 204, 204, 204, 205, 0, 0, 0,
+    131, 131, 206, 83, 0, 0, 207, 208, 132, 132, 209, 209, 0, 0, 0, 0,
+    131, 131, 210, 86, 211, 98, 212, 213, 132, 132, 214, 214, 102, 0, 0, 0,
+    0, 0, 215, 216, 217, 0, 218, 219, 220, 220, 221, 221, 222, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 223, 0, 0, 0, 224, 225, 0, 0, 0, 0,
+    0, 0, 226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+    229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+    0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+    231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    6, 7, 232, 233, 234, 235, 236, 6, 7, 6, 7, 6, 7, 237, 238, 239,
+    240, 0, 6, 7, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 241, 241,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 0,
+    0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    242, 242, 242, 242, 242, 242, 0, 242, 0, 0, 0, 0, 0, 242, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 243, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 6, 7, 244, 0, 0,
+    6, 7, 6, 7, 245, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 246, 247, 248, 249, 246, 0,
+    250, 251, 252, 253, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 254, 255, 256, 6, 7, 6, 7, 0, 0, 0, 0, 0,
+    6, 7, 0, 0, 0, 0, 6, 7, 6, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 257, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+    258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+    258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+    258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+    258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    259, 260, 261, 262, 263, 264, 264, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 265, 266, 267, 268, 269, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+    270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+    270, 270, 270, 270, 270, 270, 270, 270, 271, 271, 271, 271, 271, 271, 271, 271,
+    271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+    271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+    270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+    270, 270, 270, 270, 0, 0, 0, 0, 271, 271, 271, 271, 271, 271, 271, 271,
+    271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+    271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 0, 272, 272, 272, 272,
+    272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 0, 272, 272, 272, 272,
+    272, 272, 272, 0, 272, 272, 0, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+    273, 273, 0, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+    273, 273, 0, 273, 273, 273, 273, 273, 273, 273, 0, 273, 273, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+    275, 275, 275, 275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+];
+pub static CASE_RECORDS: [[i32; 3]; 276] = [
+    [0, 0, 0],
+    [32, 0, 0],
+    [0, -32, -32],
+    [0, 743, 743],
+    [0, 1073741825, 1073741828],
+    [0, 121, 121],
+    [1, 0, 0],
+    [0, -1, -1],
+    [1073741831, 0, 0],
+    [0, -232, -232],
+    [0, 1073741834, 1073741834],
+    [-121, 0, 0],
+    [0, -300, -300],
+    [0, 195, 195],
+    [210, 0, 0],
+    [206, 0, 0],
+    [205, 0, 0],
+    [79, 0, 0],
+    [202, 0, 0],
+    [203, 0, 0],
+    [207, 0, 0],
+    [0, 97, 97],
+    [211, 0, 0],
+    [209, 0, 0],
+    [0, 163, 163],
+    [213, 0, 0],
+    [0, 130, 130],
+    [214, 0, 0],
+    [218, 0, 0],
+    [217, 0, 0],
+    [219, 0, 0],
+    [0, 56, 56],
+    [2, 0, 1],
+    [1, -1, 0],
+    [0, -2, -1],
+    [0, -79, -79],
+    [0, 1073741837, 1073741837],
+    [-97, 0, 0],
+    [-56, 0, 0],
+    [-130, 0, 0],
+    [10795, 0, 0],
+    [-163, 0, 0],
+    [10792, 0, 0],
+    [0, 10815, 10815],
+    [-195, 0, 0],
+    [69, 0, 0],
+    [71, 0, 0],
+    [0, 10783, 10783],
+    [0, 10780, 10780],
+    [0, 10782, 10782],
+    [0, -210, -210],
+    [0, -206, -206],
+    [0, -205, -205],
+    [0, -202, -202],
+    [0, -203, -203],
+    [0, 42319, 42319],
+    [0, 42315, 42315],
+    [0, -207, -207],
+    [0, 42280, 42280],
+    [0, 42308, 42308],
+    [0, -209, -209],
+    [0, -211, -211],
+    [0, 10743, 10743],
+    [0, 42305, 42305],
+    [0, 10749, 10749],
+    [0, -213, -213],
+    [0, -214, -214],
+    [0, 10727, 10727],
+    [0, -218, -218],
+    [0, 42307, 42307],
+    [0, 42282, 42282],
+    [0, -69, -69],
+    [0, -217, -217],
+    [0, -71, -71],
+    [0, -219, -219],
+    [0, 42261, 42261],
+    [0, 42258, 42258],
+    [0, 84, 84],
+    [116, 0, 0],
+    [38, 0, 0],
+    [37, 0, 0],
+    [64, 0, 0],
+    [63, 0, 0],
+    [0, 1073741840, 1073741840],
+    [0, -38, -38],
+    [0, -37, -37],
+    [0, 1073741844, 1073741844],
+    [0, -31, -31],
+    [0, -64, -64],
+    [0, -63, -63],
+    [8, 0, 0],
+    [0, -62, -62],
+    [0, -57, -57],
+    [0, -47, -47],
+    [0, -54, -54],
+    [0, -8, -8],
+    [0, -86, -86],
+    [0, -80, -80],
+    [0, 7, 7],
+    [0, -116, -116],
+    [-60, 0, 0],
+    [0, -96, -96],
+    [-7, 0, 0],
+    [80, 0, 0],
+    [15, 0, 0],
+    [0, -15, -15],
+    [48, 0, 0],
+    [0, -48, -48],
+    [0, 1073741848, 1073741851],
+    [7264, 0, 0],
+    [0, 3008, 0],
+    [38864, 0, 0],
+    [0, -6254, -6254],
+    [0, -6253, -6253],
+    [0, -6244, -6244],
+    [0, -6242, -6242],
+    [0, -6243, -6243],
+    [0, -6236, -6236],
+    [0, -6181, -6181],
+    [0, 35266, 35266],
+    [-3008, 0, 0],
+    [0, 35332, 35332],
+    [0, 3814, 3814],
+    [0, 35384, 35384],
+    [0, 1073741854, 1073741854],
+    [0, 1073741857, 1073741857],
+    [0, 1073741860, 1073741860],
+    [0, 1073741863, 1073741863],
+    [0, 1073741866, 1073741866],
+    [0, -59, -59],
+    [-7615, 0, 0],
+    [0, 8, 8],
+    [-8, 0, 0],
+    [0, 1073741869, 1073741869],
+    [0, 1073741872, 1073741872],
+    [0, 1073741876, 1073741876],
+    [0, 1073741880, 1073741880],
+    [0, 74, 74],
+    [0, 86, 86],
+    [0, 100, 100],
+    [0, 128, 128],
+    [0, 112, 112],
+    [0, 126, 126],
+    [0, 1073741884, 8],
+    [0, 1073741887, 8],
+    [0, 1073741890, 8],
+    [0, 1073741893, 8],
+    [0, 1073741896, 8],
+    [0, 1073741899, 8],
+    [0, 1073741902, 8],
+    [0, 1073741905, 8],
+    [-8, 1073741884, 0],
+    [-8, 1073741887, 0],
+    [-8, 1073741890, 0],
+    [-8, 1073741893, 0],
+    [-8, 1073741896, 0],
+    [-8, 1073741899, 0],
+    [-8, 1073741902, 0],
+    [-8, 1073741905, 0],
+    [0, 1073741908, 8],
+    [0, 1073741911, 8],
+    [0, 1073741914, 8],
+    [0, 1073741917, 8],
+    [0, 1073741920, 8],
+    [0, 1073741923, 8],
+    [0, 1073741926, 8],
+    [0, 1073741929, 8],
+    [-8, 1073741908, 0],
+    [-8, 1073741911, 0],
+    [-8, 1073741914, 0],
+    [-8, 1073741917, 0],
+    [-8, 1073741920, 0],
+    [-8, 1073741923, 0],
+    [-8, 1073741926, 0],
+    [-8, 1073741929, 0],
+    [0, 1073741932, 8],
+    [0, 1073741935, 8],
+    [0, 1073741938, 8],
+    [0, 1073741941, 8],
+    [0, 1073741944, 8],
+    [0, 1073741947, 8],
+    [0, 1073741950, 8],
+    [0, 1073741953, 8],
+    [-8, 1073741932, 0],
+    [-8, 1073741935, 0],
+    [-8, 1073741938, 0],
+    [-8, 1073741941, 0],
+    [-8, 1073741944, 0],
+    [-8, 1073741947, 0],
+    [-8, 1073741950, 0],
+    [-8, 1073741953, 0],
+    [0, 1073741956, 1073741959],
+    [0, 1073741962, 9],
+    [0, 1073741965, 1073741968],
+    [0, 1073741971, 1073741971],
+    [0, 1073741974, 1073741978],
+    [-74, 0, 0],
+    [-9, 1073741962, 0],
+    [0, -7205, -7205],
+    [0, 1073741982, 1073741985],
+    [0, 1073741988, 9],
+    [0, 1073741991, 1073741994],
+    [0, 1073741997, 1073741997],
+    [0, 1073742000, 1073742004],
+    [-86, 0, 0],
+    [-9, 1073741988, 0],
+    [0, 1073742008, 1073742008],
+    [0, 1073742012, 1073742012],
+    [0, 1073742015, 1073742015],
+    [-100, 0, 0],
+    [0, 1073742019, 1073742019],
+    [0, 1073742023, 1073742023],
+    [0, 1073742026, 1073742026],
+    [0, 1073742029, 1073742029],
+    [-112, 0, 0],
+    [0, 1073742033, 1073742036],
+    [0, 1073742039, 9],
+    [0, 1073742042, 1073742045],
+    [0, 1073742048, 1073742048],
+    [0, 1073742051, 1073742055],
+    [-128, 0, 0],
+    [-126, 0, 0],
+    [-9, 1073742039, 0],
+    [-7517, 0, 0],
+    [-8383, 0, 0],
+    [-8262, 0, 0],
+    [28, 0, 0],
+    [0, -28, -28],
+    [16, 0, 0],
+    [0, -16, -16],
+    [26, 0, 0],
+    [0, -26, -26],
+    [-10743, 0, 0],
+    [-3814, 0, 0],
+    [-10727, 0, 0],
+    [0, -10795, -10795],
+    [0, -10792, -10792],
+    [-10780, 0, 0],
+    [-10749, 0, 0],
+    [-10783, 0, 0],
+    [-10782, 0, 0],
+    [-10815, 0, 0],
+    [0, -7264, -7264],
+    [-35332, 0, 0],
+    [-42280, 0, 0],
+    [0, 48, 48],
+    [-42308, 0, 0],
+    [-42319, 0, 0],
+    [-42315, 0, 0],
+    [-42305, 0, 0],
+    [-42258, 0, 0],
+    [-42282, 0, 0],
+    [-42261, 0, 0],
+    [928, 0, 0],
+    [-48, 0, 0],
+    [-42307, 0, 0],
+    [-35384, 0, 0],
+    [0, -928, -928],
+    [0, -38864, -38864],
+    [0, 1073742059, 1073742062],
+    [0, 1073742065, 1073742068],
+    [0, 1073742071, 1073742074],
+    [0, 1073742077, 1073742081],
+    [0, 1073742085, 1073742089],
+    [0, 1073742093, 1073742096],
+    [0, 1073742099, 1073742102],
+    [0, 1073742105, 1073742108],
+    [0, 1073742111, 1073742114],
+    [0, 1073742117, 1073742120],
+    [0, 1073742123, 1073742126],
+    [40, 0, 0],
+    [0, -40, -40],
+    [39, 0, 0],
+    [0, -39, -39],
+    [34, 0, 0],
+    [0, -34, -34],
+];
+pub static CASE_SEQUENCES: [u32; 305] = [
+    0, 2, 83, 83, 2, 83, 115, 2, 105, 775, 2, 700, 78, 2, 74, 780,
+    3, 921, 776, 769, 3, 933, 776, 769, 2, 1333, 1362, 2, 1333, 1410, 2, 72,
+    817, 2, 84, 776, 2, 87, 778, 2, 89, 778, 2, 65, 702, 2, 933, 787,
+    3, 933, 787, 768, 3, 933, 787, 769, 3, 933, 787, 834, 2, 7944, 921, 2,
+    7945, 921, 2, 7946, 921, 2, 7947, 921, 2, 7948, 921, 2, 7949, 921, 2, 7950,
+    921, 2, 7951, 921, 2, 7976, 921, 2, 7977, 921, 2, 7978, 921, 2, 7979, 921,
+    2, 7980, 921, 2, 7981, 921, 2, 7982, 921, 2, 7983, 921, 2, 8040, 921, 2,
+    8041, 921, 2, 8042, 921, 2, 8043, 921, 2, 8044, 921, 2, 8045, 921, 2, 8046,
+    921, 2, 8047, 921, 2, 8122, 921, 2, 8122, 837, 2, 913, 921, 2, 902, 921,
+    2, 902, 837, 2, 913, 834, 3, 913, 834, 921, 3, 913, 834, 837, 2, 8138,
+    921, 2, 8138, 837, 2, 919, 921, 2, 905, 921, 2, 905, 837, 2, 919, 834,
+    3, 919, 834, 921, 3, 919, 834, 837, 3, 921, 776, 768, 2, 921, 834, 3,
+    921, 776, 834, 3, 933, 776, 768, 2, 929, 787, 2, 933, 834, 3, 933, 776,
+    834, 2, 8186, 921, 2, 8186, 837, 2, 937, 921, 2, 911, 921, 2, 911, 837,
+    2, 937, 834, 3, 937, 834, 921, 3, 937, 834, 837, 2, 70, 70, 2, 70,
+    102, 2, 70, 73, 2, 70, 105, 2, 70, 76, 2, 70, 108, 3, 70, 70,
+    73, 3, 70, 102, 105, 3, 70, 70, 76, 3, 70, 102, 108, 2, 83, 84,
+    2, 83, 116, 2, 1348, 1350, 2, 1348, 1398, 2, 1348, 1333, 2, 1348, 1381, 2,
+    1348, 1339, 2, 1348, 1387, 2, 1358, 1350, 2, 1358, 1398, 2, 1348, 1341, 2, 1348,
+    1389,
+];
+
+pub const DECOMPOSITION_LIMIT: u32 = 0x2FA80;
+pub static DECOMPOSITION_INDEX: [u16; 1525] = [
+    0, 1, 2, 3, 4, 0, 5, 6, 7, 8, 0, 0, 9, 10, 0, 0,
+    0, 0, 11, 12, 13, 0, 14, 15, 16, 17, 18, 19, 0, 0, 20, 21,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 24, 25, 26, 27,
+    28, 0, 29, 30, 31, 32, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    35, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 37, 38, 39, 40, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 42, 43, 0, 0, 0, 44, 0, 0, 45, 0, 46, 0, 0, 0, 0,
+    0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    50, 51, 52, 53, 54,
+];
+pub static DECOMPOSITION_BLOCKS: [u16; 7040] = [
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 4, 7, 10, 13, 16, 0, 19, 22, 25, 28, 31, 34, 37, 40, 43,
+    0, 46, 49, 52, 55, 58, 61, 0, 0, 64, 67, 70, 73, 76, 0, 0,
+    79, 82, 85, 88, 91, 94, 0, 97, 100, 103, 106, 109, 112, 115, 118, 121,
+    0, 124, 127, 130, 133, 136, 139, 0, 0, 142, 145, 148, 151, 154, 0, 157,
+    160, 163, 166, 169, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205,
+    0, 0, 208, 211, 214, 217, 220, 223, 226, 229, 232, 235, 238, 241, 244, 247,
+    250, 253, 256, 259, 262, 265, 0, 0, 268, 271, 274, 277, 280, 283, 286, 289,
+    292, 0, 0, 0, 295, 298, 301, 304, 0, 307, 310, 313, 316, 319, 322, 0,
+    0, 0, 0, 325, 328, 331, 334, 337, 340, 0, 0, 0, 343, 346, 349, 352,
+    355, 358, 0, 0, 361, 364, 367, 370, 373, 376, 379, 382, 385, 388, 391, 394,
+    397, 400, 403, 406, 409, 412, 0, 0, 415, 418, 421, 424, 427, 430, 433, 436,
+    439, 442, 445, 448, 451, 454, 457, 460, 463, 466, 469, 472, 475, 478, 481, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    484, 487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 490,
+    493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 496, 499, 502,
+    505, 508, 511, 514, 517, 520, 524, 528, 532, 536, 540, 544, 548, 0, 552, 556,
+    560, 564, 568, 571, 0, 0, 574, 577, 580, 583, 586, 589, 592, 596, 600, 603,
+    606, 0, 0, 0, 609, 612, 0, 0, 615, 618, 621, 625, 629, 632, 635, 638,
+    641, 644, 647, 650, 653, 656, 659, 662, 665, 668, 671, 674, 677, 680, 683, 686,
+    689, 692, 695, 698, 701, 704, 707, 710, 713, 716, 719, 722, 0, 0, 725, 728,
+    0, 0, 0, 0, 0, 0, 731, 734, 737, 740, 743, 747, 751, 755, 759, 762,
+    765, 769, 773, 776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    779, 781, 0, 783, 785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 790, 0,
+    0, 0, 0, 0, 0, 792, 795, 798, 800, 803, 806, 0, 809, 0, 812, 815,
+    818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 822, 825, 828, 831, 834, 837,
+    840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 844, 847, 850, 853, 856, 0,
+    0, 0, 0, 859, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    865, 868, 0, 871, 0, 0, 0, 874, 0, 0, 0, 0, 877, 880, 883, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 886, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 889, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    892, 895, 0, 898, 0, 0, 0, 901, 0, 0, 0, 0, 904, 907, 910, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 913, 916, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 919, 922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    925, 928, 931, 934, 0, 0, 937, 940, 0, 0, 943, 946, 949, 952, 955, 958,
+    0, 0, 961, 964, 967, 970, 973, 976, 0, 0, 979, 982, 985, 988, 991, 994,
+    997, 1000, 1003, 1006, 1009, 1012, 0, 0, 1015, 1018, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1021, 1024, 1027, 1030, 1033, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1036, 0, 1039, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1045, 0, 0, 0, 0, 0, 0,
+    0, 1048, 0, 0, 1051, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1054, 1057, 1060, 1063, 1066, 1069, 1072, 1075,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1078, 1081, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1084, 1087, 0, 1090,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1093, 0, 0, 1096, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1099, 1102, 1105, 0, 0, 1108, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1111, 0, 0, 1114, 1117, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1120, 1123, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1129, 1132, 1135, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1138, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1141, 0, 0, 0, 0, 0, 0, 1144, 1147, 0, 1150, 1153, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1157, 1160, 1163, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1166, 0, 1169, 1172, 1176, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1182, 0, 0,
+    0, 0, 1185, 0, 0, 0, 0, 1188, 0, 0, 0, 0, 1191, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1194, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1197, 0, 1200, 1203, 0, 1206, 0, 0, 0, 0, 0, 0, 0,
+    0, 1209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1215, 0, 0,
+    0, 0, 1218, 0, 0, 0, 0, 1221, 0, 0, 0, 0, 1224, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1227, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1233, 0, 1236, 0, 1239, 0, 1242, 0, 1245, 0,
+    0, 0, 1248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1251, 0, 1254, 0, 0,
+    1257, 1260, 0, 1263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1294, 1298, 1301, 1304, 1307, 1310, 1313,
+    1316, 1319, 1322, 1325, 1328, 1332, 1336, 1340, 1344, 1347, 1350, 1353, 1356, 1360, 1364, 1367,
+    1370, 1373, 1376, 1379, 1382, 1385, 1388, 1391, 1394, 1397, 1400, 1403, 1406, 1409, 1412, 1416,
+    1420, 1423, 1426, 1429, 1432, 1435, 1438, 1441, 1444, 1448, 1452, 1455, 1458, 1461, 1464, 1467,
+    1470, 1473, 1476, 1479, 1482, 1485, 1488, 1491, 1494, 1497, 1500, 1503, 1506, 1510, 1514, 1518,
+    1522, 1526, 1530, 1534, 1538, 1541, 1544, 1547, 1550, 1553, 1556, 1559, 1562, 1566, 1570, 1573,
+    1576, 1579, 1582, 1585, 1588, 1592, 1596, 1600, 1604, 1608, 1612, 1615, 1618, 1621, 1624, 1627,
+    1630, 1633, 1636, 1639, 1642, 1645, 1648, 1651, 1654, 1658, 1662, 1666, 1670, 1673, 1676, 1679,
+    1682, 1685, 1688, 1691, 1694, 1697, 1700, 1703, 1706, 1709, 1712, 1715, 1718, 1721, 1724, 1727,
+    1730, 1733, 1736, 1739, 1742, 1745, 1748, 1751, 1754, 1757, 0, 1760, 0, 0, 0, 0,
+    1763, 1766, 1769, 1772, 1775, 1779, 1783, 1787, 1791, 1795, 1799, 1803, 1807, 1811, 1815, 1819,
+    1823, 1827, 1831, 1835, 1839, 1843, 1847, 1851, 1855, 1858, 1861, 1864, 1867, 1870, 1873, 1877,
+    1881, 1885, 1889, 1893, 1897, 1901, 1905, 1909, 1913, 1916, 1919, 1922, 1925, 1928, 1931, 1934,
+    1937, 1941, 1945, 1949, 1953, 1957, 1961, 1965, 1969, 1973, 1977, 1981, 1985, 1989, 1993, 1997,
+    2001, 2005, 2009, 2013, 2017, 2020, 2023, 2026, 2029, 2033, 2037, 2041, 2045, 2049, 2053, 2057,
+    2061, 2065, 2069, 2072, 2075, 2078, 2081, 2084, 2087, 2090, 0, 0, 0, 0, 0, 0,
+    2093, 2096, 2099, 2103, 2107, 2111, 2115, 2119, 2123, 2126, 2129, 2133, 2137, 2141, 2145, 2149,
+    2153, 2156, 2159, 2163, 2167, 2171, 0, 0, 2175, 2178, 2181, 2185, 2189, 2193, 0, 0,
+    2197, 2200, 2203, 2207, 2211, 2215, 2219, 2223, 2227, 2230, 2233, 2237, 2241, 2245, 2249, 2253,
+    2257, 2260, 2263, 2267, 2271, 2275, 2279, 2283, 2287, 2290, 2293, 2297, 2301, 2305, 2309, 2313,
+    2317, 2320, 2323, 2327, 2331, 2335, 0, 0, 2339, 2342, 2345, 2349, 2353, 2357, 0, 0,
+    2361, 2364, 2367, 2371, 2375, 2379, 2383, 2387, 0, 2391, 0, 2394, 0, 2398, 0, 2402,
+    2406, 2409, 2412, 2416, 2420, 2424, 2428, 2432, 2436, 2439, 2442, 2446, 2450, 2454, 2458, 2462,
+    2466, 2469, 2472, 2475, 2478, 2481, 2484, 2487, 2490, 2493, 2496, 2499, 2502, 2505, 0, 0,
+    2508, 2512, 2516, 2521, 2526, 2531, 2536, 2541, 2546, 2550, 2554, 2559, 2564, 2569, 2574, 2579,
+    2584, 2588, 2592, 2597, 2602, 2607, 2612, 2617, 2622, 2626, 2630, 2635, 2640, 2645, 2650, 2655,
+    2660, 2664, 2668, 2673, 2678, 2683, 2688, 2693, 2698, 2702, 2706, 2711, 2716, 2721, 2726, 2731,
+    2736, 2739, 2742, 2746, 2749, 0, 2753, 2756, 2760, 2763, 2766, 2769, 2772, 0, 2775, 0,
+    0, 2777, 2780, 2784, 2787, 0, 2791, 2794, 2798, 2801, 2804, 2807, 2810, 2813, 2816, 2819,
+    2822, 2825, 2828, 2832, 0, 0, 2836, 2839, 2843, 2846, 2849, 2852, 0, 2855, 2858, 2861,
+    2864, 2867, 2870, 2874, 2878, 2881, 2884, 2887, 2891, 2894, 2897, 2900, 2903, 2906, 2909, 2912,
+    0, 0, 2914, 2918, 2921, 0, 2925, 2928, 2932, 2935, 2938, 2941, 2944, 2947, 0, 0,
+    2949, 2951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2953, 0, 0, 0, 2955, 2957, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2960, 2963, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2966, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2969, 2972, 2975,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2978, 0, 0, 0, 0, 2981, 0, 0, 2984, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2987, 0, 2990, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2993, 0, 0, 2996, 0, 0, 2999, 0, 3002, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3005, 0, 3008, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3011, 3014, 3017,
+    3020, 3023, 0, 0, 3026, 3029, 0, 0, 3032, 3035, 0, 0, 0, 0, 0, 0,
+    3038, 3041, 0, 0, 3044, 3047, 0, 0, 3050, 3053, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3056, 3059, 3062, 3065,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3068, 3071, 3074, 3077, 0, 0, 0, 0, 0, 0, 3080, 3083, 3086, 3089, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3092, 3094, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3096, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3099, 0, 3102, 0,
+    3105, 0, 3108, 0, 3111, 0, 3114, 0, 3117, 0, 3120, 0, 3123, 0, 3126, 0,
+    3129, 0, 3132, 0, 0, 3135, 0, 3138, 0, 3141, 0, 0, 0, 0, 0, 0,
+    3144, 3147, 0, 3150, 3153, 0, 3156, 3159, 0, 3162, 3165, 0, 3168, 3171, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3177, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3180, 0, 3183, 0,
+    3186, 0, 3189, 0, 3192, 0, 3195, 0, 3198, 0, 3201, 0, 3204, 0, 3207, 0,
+    3210, 0, 3213, 0, 0, 3216, 0, 3219, 0, 3222, 0, 0, 0, 0, 0, 0,
+    3225, 3228, 0, 3231, 3234, 0, 3237, 3240, 0, 3243, 3246, 0, 3249, 3252, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3255, 0, 0, 3258, 3261, 3264, 3267, 0, 0, 0, 3270, 0,
+    3273, 3275, 3277, 3279, 3281, 3283, 3285, 3287, 3289, 3291, 3293, 3295, 3297, 3299, 3301, 3303,
+    3305, 3307, 3309, 3311, 3313, 3315, 3317, 3319, 3321, 3323, 3325, 3327, 3329, 3331, 3333, 3335,
+    3337, 3339, 3341, 3343, 3345, 3347, 3349, 3351, 3353, 3355, 3357, 3359, 3361, 3363, 3365, 3367,
+    3369, 3371, 3373, 3375, 3377, 3379, 3381, 3383, 3385, 3387, 3389, 3391, 3393, 3395, 3397, 3399,
+    3401, 3403, 3405, 3407, 3409, 3411, 3413, 3415, 3417, 3419, 3421, 3423, 3425, 3427, 3429, 3431,
+    3433, 3435, 3437, 3439, 3441, 3443, 3445, 3447, 3449, 3451, 3453, 3455, 3457, 3459, 3461, 3463,
+    3465, 3467, 3469, 3471, 3473, 3475, 3477, 3479, 3481, 3483, 3485, 3487, 3489, 3491, 3493, 3495,
+    3497, 3499, 3501, 3503, 3505, 3507, 3509, 3511, 3513, 3515, 3517, 3519, 3521, 3523, 3525, 3527,
+    3529, 3531, 3533, 3535, 3537, 3539, 3541, 3543, 3545, 3547, 3549, 3551, 3553, 3555, 3557, 3559,
+    3561, 3563, 3565, 3567, 3569, 3571, 3573, 3575, 3577, 3579, 3581, 3583, 3585, 3587, 3589, 3591,
+    3593, 3595, 3597, 3599, 3601, 3603, 3605, 3607, 3609, 3611, 3613, 3615, 3617, 3619, 3621, 3623,
+    3625, 3627, 3629, 3631, 3633, 3635, 3637, 3639, 3641, 3643, 3645, 3647, 3649, 3651, 3653, 3655,
+    3657, 3659, 3661, 3663, 3665, 3667, 3669, 3671, 3673, 3675, 3677, 3679, 3681, 3683, 3685, 3687,
+    3689, 3691, 3693, 3695, 3697, 3699, 3701, 3703, 3705, 3707, 3709, 3711, 3713, 3715, 3717, 3719,
+    3721, 3723, 3725, 3727, 3729, 3731, 3733, 3735, 3737, 3739, 3741, 3743, 3745, 3747, 3749, 3751,
+    3753, 3755, 3757, 3759, 3761, 3763, 3765, 3767, 3769, 3771, 3773, 3775, 3777, 3779, 3781, 3783,
+    3785, 3787, 3789, 3791, 3793, 3795, 3797, 3799, 3801, 3803, 3805, 3807, 3809, 3811, 0, 0,
+    3813, 0, 3815, 0, 0, 3817, 3819, 3821, 3823, 3825, 3827, 3829, 3831, 3833, 3835, 0,
+    3837, 0, 3839, 0, 0, 3841, 3843, 0, 0, 0, 3845, 3847, 3849, 3851, 3853, 3855,
+    3857, 3859, 3861, 3863, 3865, 3867, 3869, 3871, 3873, 3875, 3877, 3879, 3881, 3883, 3885, 3887,
+    3889, 3891, 3893, 3895, 3897, 3899, 3901, 3903, 3905, 3907, 3909, 3911, 3913, 3915, 3917, 3919,
+    3921, 3923, 3925, 3927, 3929, 3931, 3933, 3935, 3937, 3939, 3941, 3943, 3945, 3947, 3949, 3951,
+    3953, 3955, 3957, 3959, 3961, 3963, 3965, 3967, 3969, 3971, 3973, 3975, 3977, 3979, 0, 0,
+    3981, 3983, 3985, 3987, 3989, 3991, 3993, 3995, 3997, 3999, 4001, 4003, 4005, 4007, 4009, 4011,
+    4013, 4015, 4017, 4019, 4021, 4023, 4025, 4027, 4029, 4031, 4033, 4035, 4037, 4039, 4041, 4043,
+    4045, 4047, 4049, 4051, 4053, 4055, 4057, 4059, 4061, 4063, 4065, 4067, 4069, 4071, 4073, 4075,
+    4077, 4079, 4081, 4083, 4085, 4087, 4089, 4091, 4093, 4095, 4097, 4099, 4101, 4103, 4105, 4107,
+    4109, 4111, 4113, 4115, 4117, 4119, 4121, 4123, 4125, 4127, 4129, 4131, 4133, 4135, 4137, 4139,
+    4141, 4143, 4145, 4147, 4149, 4151, 4153, 4155, 4157, 4159, 4161, 4163, 4165, 4167, 4169, 4171,
+    4173, 4175, 4177, 4179, 4181, 4183, 4185, 4187, 4189, 4191, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4193, 0, 4196,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4199, 4202, 4205, 4209, 4213, 4216,
+    4219, 4222, 4225, 4228, 4231, 4234, 4237, 0, 4240, 4243, 4246, 4249, 4252, 0, 4255, 0,
+    4258, 4261, 0, 4264, 4267, 0, 4270, 4273, 4276, 4279, 4282, 4285, 4288, 4291, 4294, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4297, 0, 4300, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4303, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4306, 4309,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4312, 4315, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4318, 4321, 0, 4324, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4327, 4330, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4333, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4336, 4339,
+    4342, 4346, 4350, 4354, 4358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4362, 4365, 4368, 4372, 4376,
+    4380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4384, 4386, 4388, 4390, 4392, 4394, 4396, 4398, 4400, 4402, 4404, 4406, 4408, 4410, 4412, 4414,
+    4416, 4418, 4420, 4422, 4424, 4426, 4428, 4430, 4432, 4434, 4436, 4438, 4440, 4442, 4444, 4446,
+    4448, 4450, 4452, 4454, 4456, 4458, 4460, 4462, 4464, 4466, 4468, 4470, 4472, 4474, 4476, 4478,
+    4480, 4482, 4484, 4486, 4488, 4490, 4492, 4494, 4496, 4498, 4500, 4502, 4504, 4506, 4508, 4510,
+    4512, 4514, 4516, 4518, 4520, 4522, 4524, 4526, 4528, 4530, 4532, 4534, 4536, 4538, 4540, 4542,
+    4544, 4546, 4548, 4550, 4552, 4554, 4556, 4558, 4560, 4562, 4564, 4566, 4568, 4570, 4572, 4574,
+    4576, 4578, 4580, 4582, 4584, 4586, 4588, 4590, 4592, 4594, 4596, 4598, 4600, 4602, 4604, 4606,
+    4608, 4610, 4612, 4614, 4616, 4618, 4620, 4622, 4624, 4626, 4628, 4630, 4632, 4634, 4636, 4638,
+    4640, 4642, 4644, 4646, 4648, 4650, 4652, 4654, 4656, 4658, 4660, 4662, 4664, 4666, 4668, 4670,
+    4672, 4674, 4676, 4678, 4680, 4682, 4684, 4686, 4688, 4690, 4692, 4694, 4696, 4698, 4700, 4702,
+    4704, 4706, 4708, 4710, 4712, 4714, 4716, 4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734,
+    4736, 4738, 4740, 4742, 4744, 4746, 4748, 4750, 4752, 4754, 4756, 4758, 4760, 4762, 4764, 4766,
+    4768, 4770, 4772, 4774, 4776, 4778, 4780, 4782, 4784, 4786, 4788, 4790, 4792, 4794, 4796, 4798,
+    4800, 4802, 4804, 4806, 4808, 4810, 4812, 4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830,
+    4832, 4834, 4836, 4838, 4840, 4842, 4844, 4846, 4848, 4850, 4852, 4854, 4856, 4858, 4860, 4862,
+    4864, 4866, 4868, 4870, 4872, 4874, 4876, 4878, 4880, 4882, 4884, 4886, 4888, 4890, 4892, 4894,
+    4896, 4898, 4900, 4902, 4904, 4906, 4908, 4910, 4912, 4914, 4916, 4918, 4920, 4922, 4924, 4926,
+    4928, 4930, 4932, 4934, 4936, 4938, 4940, 4942, 4944, 4946, 4948, 4950, 4952, 4954, 4956, 4958,
+    4960, 4962, 4964, 4966, 4968, 4970, 4972, 4974, 4976, 4978, 4980, 4982, 4984, 4986, 4988, 4990,
+    4992, 4994, 4996, 4998, 5000, 5002, 5004, 5006, 5008, 5010, 5012, 5014, 5016, 5018, 5020, 5022,
+    5024, 5026, 5028, 5030, 5032, 5034, 5036, 5038, 5040, 5042, 5044, 5046, 5048, 5050, 5052, 5054,
+    5056, 5058, 5060, 5062, 5064, 5066, 5068, 5070, 5072, 5074, 5076, 5078, 5080, 5082, 5084, 5086,
+    5088, 5090, 5092, 5094, 5096, 5098, 5100, 5102, 5104, 5106, 5108, 5110, 5112, 5114, 5116, 5118,
+    5120, 5122, 5124, 5126, 5128, 5130, 5132, 5134, 5136, 5138, 5140, 5142, 5144, 5146, 5148, 5150,
+    5152, 5154, 5156, 5158, 5160, 5162, 5164, 5166, 5168, 5170, 5172, 5174, 5176, 5178, 5180, 5182,
+    5184, 5186, 5188, 5190, 5192, 5194, 5196, 5198, 5200, 5202, 5204, 5206, 5208, 5210, 5212, 5214,
+    5216, 5218, 5220, 5222, 5224, 5226, 5228, 5230, 5232, 5234, 5236, 5238, 5240, 5242, 5244, 5246,
+    5248, 5250, 5252, 5254, 5256, 5258, 5260, 5262, 5264, 5266, 5268, 5270, 5272, 5274, 5276, 5278,
+    5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294, 5296, 5298, 5300, 5302, 5304, 5306, 5308, 5310,
+    5312, 5314, 5316, 5318, 5320, 5322, 5324, 5326, 5328, 5330, 5332, 5334, 5336, 5338, 5340, 5342,
+    5344, 5346, 5348, 5350, 5352, 5354, 5356, 5358, 5360, 5362, 5364, 5366, 5368, 5370, 5372, 5374,
+    5376, 5378, 5380, 5382, 5384, 5386, 5388, 5390, 5392, 5394, 5396, 5398, 5400, 5402, 5404, 5406,
+    5408, 5410, 5412, 5414, 5416, 5418, 5420, 5422, 5424, 5426, 5428, 5430, 5432, 5434, 5436, 5438,
+    5440, 5442, 5444, 5446, 5448, 5450, 5452, 5454, 5456, 5458, 5460, 5462, 5464, 5466, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+];
+pub static DECOMPOSITION_SEQUENCES: [u32; 5468] = [
+    0, 2, 65, 768, 2, 65, 769, 2, 65, 770, 2, 65, 771, 2, 65, 776,
+    2, 65, 778, 2, 67, 807, 2, 69, 768, 2, 69, 769, 2, 69, 770, 2,
+    69, 776, 2, 73, 768, 2, 73, 769, 2, 73, 770, 2, 73, 776, 2, 78,
+    771, 2, 79, 768, 2, 79, 769, 2, 79, 770, 2, 79, 771, 2, 79, 776,
+    2, 85, 768, 2, 85, 769, 2, 85, 770, 2, 85, 776, 2, 89, 769, 2,
+    97, 768, 2, 97, 769, 2, 97, 770, 2, 97, 771, 2, 97, 776, 2, 97,
+    778, 2, 99, 807, 2, 101, 768, 2, 101, 769, 2, 101, 770, 2, 101, 776,
+    2, 105, 768, 2, 105, 769, 2, 105, 770, 2, 105, 776, 2, 110, 771, 2,
+    111, 768, 2, 111, 769, 2, 111, 770, 2, 111, 771, 2, 111, 776, 2, 117,
+    768, 2, 117, 769, 2, 117, 770, 2, 117, 776, 2, 121, 769, 2, 121, 776,
+    2, 65, 772, 2, 97, 772, 2, 65, 774, 2, 97, 774, 2, 65, 808, 2,
+    97, 808, 2, 67, 769, 2, 99, 769, 2, 67, 770, 2, 99, 770, 2, 67,
+    775, 2, 99, 775, 2, 67, 780, 2, 99, 780, 2, 68, 780, 2, 100, 780,
+    2, 69, 772, 2, 101, 772, 2, 69, 774, 2, 101, 774, 2, 69, 775, 2,
+    101, 775, 2, 69, 808, 2, 101, 808, 2, 69, 780, 2, 101, 780, 2, 71,
+    770, 2, 103, 770, 2, 71, 774, 2, 103, 774, 2, 71, 775, 2, 103, 775,
+    2, 71, 807, 2, 103, 807, 2, 72, 770, 2, 104, 770, 2, 73, 771, 2,
+    105, 771, 2, 73, 772, 2, 105, 772, 2, 73, 774, 2, 105, 774, 2, 73,
+    808, 2, 105, 808, 2, 73, 775, 2, 74, 770, 2, 106, 770, 2, 75, 807,
+    2, 107, 807, 2, 76, 769, 2, 108, 769, 2, 76, 807, 2, 108, 807, 2,
+    76, 780, 2, 108, 780, 2, 78, 769, 2, 110, 769, 2, 78, 807, 2, 110,
+    807, 2, 78, 780, 2, 110, 780, 2, 79, 772, 2, 111, 772, 2, 79, 774,
+    2, 111, 774, 2, 79, 779, 2, 111, 779, 2, 82, 769, 2, 114, 769, 2,
+    82, 807, 2, 114, 807, 2, 82, 780, 2, 114, 780, 2, 83, 769, 2, 115,
+    769, 2, 83, 770, 2, 115, 770, 2, 83, 807, 2, 115, 807, 2, 83, 780,
+    2, 115, 780, 2, 84, 807, 2, 116, 807, 2, 84, 780, 2, 116, 780, 2,
+    85, 771, 2, 117, 771, 2, 85, 772, 2, 117, 772, 2, 85, 774, 2, 117,
+    774, 2, 85, 778, 2, 117, 778, 2, 85, 779, 2, 117, 779, 2, 85, 808,
+    2, 117, 808, 2, 87, 770, 2, 119, 770, 2, 89, 770, 2, 121, 770, 2,
+    89, 776, 2, 90, 769, 2, 122, 769, 2, 90, 775, 2, 122, 775, 2, 90,
+    780, 2, 122, 780, 2, 79, 795, 2, 111, 795, 2, 85, 795, 2, 117, 795,
+    2, 65, 780, 2, 97, 780, 2, 73, 780, 2, 105, 780, 2, 79, 780, 2,
+    111, 780, 2, 85, 780, 2, 117, 780, 3, 85, 776, 772, 3, 117, 776, 772,
+    3, 85, 776, 769, 3, 117, 776, 769, 3, 85, 776, 780, 3, 117, 776, 780,
+    3, 85, 776, 768, 3, 117, 776, 768, 3, 65, 776, 772, 3, 97, 776, 772,
+    3, 65, 775, 772, 3, 97, 775, 772, 2, 198, 772, 2, 230, 772, 2, 71,
+    780, 2, 103, 780, 2, 75, 780, 2, 107, 780, 2, 79, 808, 2, 111, 808,
+    3, 79, 808, 772, 3, 111, 808, 772, 2, 439, 780, 2, 658, 780, 2, 106,
+    780, 2, 71, 769, 2, 103, 769, 2, 78, 768, 2, 110, 768, 3, 65, 778,
+    769, 3, 97, 778, 769, 2, 198, 769, 2, 230, 769, 2, 216, 769, 2, 248,
+    769, 2, 65, 783, 2, 97, 783, 2, 65, 785, 2, 97, 785, 2, 69, 783,
+    2, 101, 783, 2, 69, 785, 2, 101, 785, 2, 73, 783, 2, 105, 783, 2,
+    73, 785, 2, 105, 785, 2, 79, 783, 2, 111, 783, 2, 79, 785, 2, 111,
+    785, 2, 82, 783, 2, 114, 783, 2, 82, 785, 2, 114, 785, 2, 85, 783,
+    2, 117, 783, 2, 85, 785, 2, 117, 785, 2, 83, 806, 2, 115, 806, 2,
+    84, 806, 2, 116, 806, 2, 72, 780, 2, 104, 780, 2, 65, 775, 2, 97,
+    775, 2, 69, 807, 2, 101, 807, 3, 79, 776, 772, 3, 111, 776, 772, 3,
+    79, 771, 772, 3, 111, 771, 772, 2, 79, 775, 2, 111, 775, 3, 79, 775,
+    772, 3, 111, 775, 772, 2, 89, 772, 2, 121, 772, 1, 768, 1, 769, 1,
+    787, 2, 776, 769, 1, 697, 1, 59, 2, 168, 769, 2, 913, 769, 1, 183,
+    2, 917, 769, 2, 919, 769, 2, 921, 769, 2, 927, 769, 2, 933, 769, 2,
+    937, 769, 3, 953, 776, 769, 2, 921, 776, 2, 933, 776, 2, 945, 769, 2,
+    949, 769, 2, 951, 769, 2, 953, 769, 3, 965, 776, 769, 2, 953, 776, 2,
+    965, 776, 2, 959, 769, 2, 965, 769, 2, 969, 769, 2, 978, 769, 2, 978,
+    776, 2, 1045, 768, 2, 1045, 776, 2, 1043, 769, 2, 1030, 776, 2, 1050, 769,
+    2, 1048, 768, 2, 1059, 774, 2, 1048, 774, 2, 1080, 774, 2, 1077, 768, 2,
+    1077, 776, 2, 1075, 769, 2, 1110, 776, 2, 1082, 769, 2, 1080, 768, 2, 1091,
+    774, 2, 1140, 783, 2, 1141, 783, 2, 1046, 774, 2, 1078, 774, 2, 1040, 774,
+    2, 1072, 774, 2, 1040, 776, 2, 1072, 776, 2, 1045, 774, 2, 1077, 774, 2,
+    1240, 776, 2, 1241, 776, 2, 1046, 776, 2, 1078, 776, 2, 1047, 776, 2, 1079,
+    776, 2, 1048, 772, 2, 1080, 772, 2, 1048, 776, 2, 1080, 776, 2, 1054, 776,
+    2, 1086, 776, 2, 1256, 776, 2, 1257, 776, 2, 1069, 776, 2, 1101, 776, 2,
+    1059, 772, 2, 1091, 772, 2, 1059, 776, 2, 1091, 776, 2, 1059, 779, 2, 1091,
+    779, 2, 1063, 776, 2, 1095, 776, 2, 1067, 776, 2, 1099, 776, 2, 1575, 1619,
+    2, 1575, 1620, 2, 1608, 1620, 2, 1575, 1621, 2, 1610, 1620, 2, 1749, 1620, 2,
+    1729, 1620, 2, 1746, 1620, 2, 2344, 2364, 2, 2352, 2364, 2, 2355, 2364, 2, 2325,
+    2364, 2, 2326, 2364, 2, 2327, 2364, 2, 2332, 2364, 2, 2337, 2364, 2, 2338, 2364,
+    2, 2347, 2364, 2, 2351, 2364, 2, 2503, 2494, 2, 2503, 2519, 2, 2465, 2492, 2,
+    2466, 2492, 2, 2479, 2492, 2, 2610, 2620, 2, 2616, 2620, 2, 2582, 2620, 2, 2583,
+    2620, 2, 2588, 2620, 2, 2603, 2620, 2, 2887, 2902, 2, 2887, 2878, 2, 2887, 2903,
+    2, 2849, 2876, 2, 2850, 2876, 2, 2962, 3031, 2, 3014, 3006, 2, 3015, 3006, 2,
+    3014, 3031, 2, 3142, 3158, 2, 3263, 3285, 2, 3270, 3285, 2, 3270, 3286, 2, 3270,
+    3266, 3, 3270, 3266, 3285, 2, 3398, 3390, 2, 3399, 3390, 2, 3398, 3415, 2, 3545,
+    3530, 2, 3545, 3535, 3, 3545, 3535, 3530, 2, 3545, 3551, 2, 3906, 4023, 2, 3916,
+    4023, 2, 3921, 4023, 2, 3926, 4023, 2, 3931, 4023, 2, 3904, 4021, 2, 3953, 3954,
+    2, 3953, 3956, 2, 4018, 3968, 2, 4019, 3968, 2, 3953, 3968, 2, 3986, 4023, 2,
+    3996, 4023, 2, 4001, 4023, 2, 4006, 4023, 2, 4011, 4023, 2, 3984, 4021, 2, 4133,
+    4142, 2, 6917, 6965, 2, 6919, 6965, 2, 6921, 6965, 2, 6923, 6965, 2, 6925, 6965,
+    2, 6929, 6965, 2, 6970, 6965, 2, 6972, 6965, 2, 6974, 6965, 2, 6975, 6965, 2,
+    6978, 6965, 2, 65, 805, 2, 97, 805, 2, 66, 775, 2, 98, 775, 2, 66,
+    803, 2, 98, 803, 2, 66, 817, 2, 98, 817, 3, 67, 807, 769, 3, 99,
+    807, 769, 2, 68, 775, 2, 100, 775, 2, 68, 803, 2, 100, 803, 2, 68,
+    817, 2, 100, 817, 2, 68, 807, 2, 100, 807, 2, 68, 813, 2, 100, 813,
+    3, 69, 772, 768, 3, 101, 772, 768, 3, 69, 772, 769, 3, 101, 772, 769,
+    2, 69, 813, 2, 101, 813, 2, 69, 816, 2, 101, 816, 3, 69, 807, 774,
+    3, 101, 807, 774, 2, 70, 775, 2, 102, 775, 2, 71, 772, 2, 103, 772,
+    2, 72, 775, 2, 104, 775, 2, 72, 803, 2, 104, 803, 2, 72, 776, 2,
+    104, 776, 2, 72, 807, 2, 104, 807, 2, 72, 814, 2, 104, 814, 2, 73,
+    816, 2, 105, 816, 3, 73, 776, 769, 3, 105, 776, 769, 2, 75, 769, 2,
+    107, 769, 2, 75, 803, 2, 107, 803, 2, 75, 817, 2, 107, 817, 2, 76,
+    803, 2, 108, 803, 3, 76, 803, 772, 3, 108, 803, 772, 2, 76, 817, 2,
+    108, 817, 2, 76, 813, 2, 108, 813, 2, 77, 769, 2, 109, 769, 2, 77,
+    775, 2, 109, 775, 2, 77, 803, 2, 109, 803, 2, 78, 775, 2, 110, 775,
+    2, 78, 803, 2, 110, 803, 2, 78, 817, 2, 110, 817, 2, 78, 813, 2,
+    110, 813, 3, 79, 771, 769, 3, 111, 771, 769, 3, 79, 771, 776, 3, 111,
+    771, 776, 3, 79, 772, 768, 3, 111, 772, 768, 3, 79, 772, 769, 3, 111,
+    772, 769, 2, 80, 769, 2, 112, 769, 2, 80, 775, 2, 112, 775, 2, 82,
+    775, 2, 114, 775, 2, 82, 803, 2, 114, 803, 3, 82, 803, 772, 3, 114,
+    803, 772, 2, 82, 817, 2, 114, 817, 2, 83, 775, 2, 115, 775, 2, 83,
+    803, 2, 115, 803, 3, 83, 769, 775, 3, 115, 769, 775, 3, 83, 780, 775,
+    3, 115, 780, 775, 3, 83, 803, 775, 3, 115, 803, 775, 2, 84, 775, 2,
+    116, 775, 2, 84, 803, 2, 116, 803, 2, 84, 817, 2, 116, 817, 2, 84,
+    813, 2, 116, 813, 2, 85, 804, 2, 117, 804, 2, 85, 816, 2, 117, 816,
+    2, 85, 813, 2, 117, 813, 3, 85, 771, 769, 3, 117, 771, 769, 3, 85,
+    772, 776, 3, 117, 772, 776, 2, 86, 771, 2, 118, 771, 2, 86, 803, 2,
+    118, 803, 2, 87, 768, 2, 119, 768, 2, 87, 769, 2, 119, 769, 2, 87,
+    776, 2, 119, 776, 2, 87, 775, 2, 119, 775, 2, 87, 803, 2, 119, 803,
+    2, 88, 775, 2, 120, 775, 2, 88, 776, 2, 120, 776, 2, 89, 775, 2,
+    121, 775, 2, 90, 770, 2, 122, 770, 2, 90, 803, 2, 122, 803, 2, 90,
+    817, 2, 122, 817, 2, 104, 817, 2, 116, 776, 2, 119, 778, 2, 121, 778,
+    2, 383, 775, 2, 65, 803, 2, 97, 803, 2, 65, 777, 2, 97, 777, 3,
+    65, 770, 769, 3, 97, 770, 769, 3, 65, 770, 768, 3, 97, 770, 768, 3,
+    65, 770, 777, 3, 97, 770, 777, 3, 65, 770, 771, 3, 97, 770, 771, 3,
+    65, 803, 770, 3, 97, 803, 770, 3, 65, 774, 769, 3, 97, 774, 769, 3,
+    65, 774, 768, 3, 97, 774, 768, 3, 65, 774, 777, 3, 97, 774, 777, 3,
+    65, 774, 771, 3, 97, 774, 771, 3, 65, 803, 774, 3, 97, 803, 774, 2,
+    69, 803, 2, 101, 803, 2, 69, 777, 2, 101, 777, 2, 69, 771, 2, 101,
+    771, 3, 69, 770, 769, 3, 101, 770, 769, 3, 69, 770, 768, 3, 101, 770,
+    768, 3, 69, 770, 777, 3, 101, 770, 777, 3, 69, 770, 771, 3, 101, 770,
+    771, 3, 69, 803, 770, 3, 101, 803, 770, 2, 73, 777, 2, 105, 777, 2,
+    73, 803, 2, 105, 803, 2, 79, 803, 2, 111, 803, 2, 79, 777, 2, 111,
+    777, 3, 79, 770, 769, 3, 111, 770, 769, 3, 79, 770, 768, 3, 111, 770,
+    768, 3, 79, 770, 777, 3, 111, 770, 777, 3, 79, 770, 771, 3, 111, 770,
+    771, 3, 79, 803, 770, 3, 111, 803, 770, 3, 79, 795, 769, 3, 111, 795,
+    769, 3, 79, 795, 768, 3, 111, 795, 768, 3, 79, 795, 777, 3, 111, 795,
+    777, 3, 79, 795, 771, 3, 111, 795, 771, 3, 79, 795, 803, 3, 111, 795,
+    803, 2, 85, 803, 2, 117, 803, 2, 85, 777, 2, 117, 777, 3, 85, 795,
+    769, 3, 117, 795, 769, 3, 85, 795, 768, 3, 117, 795, 768, 3, 85, 795,
+    777, 3, 117, 795, 777, 3, 85, 795, 771, 3, 117, 795, 771, 3, 85, 795,
+    803, 3, 117, 795, 803, 2, 89, 768, 2, 121, 768, 2, 89, 803, 2, 121,
+    803, 2, 89, 777, 2, 121, 777, 2, 89, 771, 2, 121, 771, 2, 945, 787,
+    2, 945, 788, 3, 945, 787, 768, 3, 945, 788, 768, 3, 945, 787, 769, 3,
+    945, 788, 769, 3, 945, 787, 834, 3, 945, 788, 834, 2, 913, 787, 2, 913,
+    788, 3, 913, 787, 768, 3, 913, 788, 768, 3, 913, 787, 769, 3, 913, 788,
+    769, 3, 913, 787, 834, 3, 913, 788, 834, 2, 949, 787, 2, 949, 788, 3,
+    949, 787, 768, 3, 949, 788, 768, 3, 949, 787, 769, 3, 949, 788, 769, 2,
+    917, 787, 2, 917, 788, 3, 917, 787, 768, 3, 917, 788, 768, 3, 917, 787,
+    769, 3, 917, 788, 769, 2, 951, 787, 2, 951, 788, 3, 951, 787, 768, 3,
+    951, 788, 768, 3, 951, 787, 769, 3, 951, 788, 769, 3, 951, 787, 834, 3,
+    951, 788, 834, 2, 919, 787, 2, 919, 788, 3, 919, 787, 768, 3, 919, 788,
+    768, 3, 919, 787, 769, 3, 919, 788, 769, 3, 919, 787, 834, 3, 919, 788,
+    834, 2, 953, 787, 2, 953, 788, 3, 953, 787, 768, 3, 953, 788, 768, 3,
+    953, 787, 769, 3, 953, 788, 769, 3, 953, 787, 834, 3, 953, 788, 834, 2,
+    921, 787, 2, 921, 788, 3, 921, 787, 768, 3, 921, 788, 768, 3, 921, 787,
+    769, 3, 921, 788, 769, 3, 921, 787, 834, 3, 921, 788, 834, 2, 959, 787,
+    2, 959, 788, 3, 959, 787, 768, 3, 959, 788, 768, 3, 959, 787, 769, 3,
+    959, 788, 769, 2, 927, 787, 2, 927, 788, 3, 927, 787, 768, 3, 927, 788,
+    768, 3, 927, 787, 769, 3, 927, 788, 769, 2, 965, 787, 2, 965, 788, 3,
+    965, 787, 768, 3, 965, 788, 768, 3, 965, 787, 769, 3, 965, 788, 769, 3,
+    965, 787, 834, 3, 965, 788, 834, 2, 933, 788, 3, 933, 788, 768, 3, 933,
+    788, 769, 3, 933, 788, 834, 2, 969, 787, 2, 969, 788, 3, 969, 787, 768,
+    3, 969, 788, 768, 3, 969, 787, 769, 3, 969, 788, 769, 3, 969, 787, 834,
+    3, 969, 788, 834, 2, 937, 787, 2, 937, 788, 3, 937, 787, 768, 3, 937,
+    788, 768, 3, 937, 787, 769, 3, 937, 788, 769, 3, 937, 787, 834, 3, 937,
+    788, 834, 2, 945, 768, 2, 945, 769, 2, 949, 768, 2, 949, 769, 2, 951,
+    768, 2, 951, 769, 2, 953, 768, 2, 953, 769, 2, 959, 768, 2, 959, 769,
+    2, 965, 768, 2, 965, 769, 2, 969, 768, 2, 969, 769, 3, 945, 787, 837,
+    3, 945, 788, 837, 4, 945, 787, 768, 837, 4, 945, 788, 768, 837, 4, 945,
+    787, 769, 837, 4, 945, 788, 769, 837, 4, 945, 787, 834, 837, 4, 945, 788,
+    834, 837, 3, 913, 787, 837, 3, 913, 788, 837, 4, 913, 787, 768, 837, 4,
+    913, 788, 768, 837, 4, 913, 787, 769, 837, 4, 913, 788, 769, 837, 4, 913,
+    787, 834, 837, 4, 913, 788, 834, 837, 3, 951, 787, 837, 3, 951, 788, 837,
+    4, 951, 787, 768, 837, 4, 951, 788, 768, 837, 4, 951, 787, 769, 837, 4,
+    951, 788, 769, 837, 4, 951, 787, 834, 837, 4, 951, 788, 834, 837, 3, 919,
+    787, 837, 3, 919, 788, 837, 4, 919, 787, 768, 837, 4, 919, 788, 768, 837,
+    4, 919, 787, 769, 837, 4, 919, 788, 769, 837, 4, 919, 787, 834, 837, 4,
+    919, 788, 834, 837, 3, 969, 787, 837, 3, 969, 788, 837, 4, 969, 787, 768,
+    837, 4, 969, 788, 768, 837, 4, 969, 787, 769, 837, 4, 969, 788, 769, 837,
+    4, 969, 787, 834, 837, 4, 969, 788, 834, 837, 3, 937, 787, 837, 3, 937,
+    788, 837, 4, 937, 787, 768, 837, 4, 937, 788, 768, 837, 4, 937, 787, 769,
+    837, 4, 937, 788, 769, 837, 4, 937, 787, 834, 837, 4, 937, 788, 834, 837,
+    2, 945, 774, 2, 945, 772, 3, 945, 768, 837, 2, 945, 837, 3, 945, 769,
+    837, 2, 945, 834, 3, 945, 834, 837, 2, 913, 774, 2, 913, 772, 2, 913,
+    768, 2, 913, 769, 2, 913, 837, 1, 953, 2, 168, 834, 3, 951, 768, 837,
+    2, 951, 837, 3, 951, 769, 837, 2, 951, 834, 3, 951, 834, 837, 2, 917,
+    768, 2, 917, 769, 2, 919, 768, 2, 919, 769, 2, 919, 837, 2, 8127, 768,
+    2, 8127, 769, 2, 8127, 834, 2, 953, 774, 2, 953, 772, 3, 953, 776, 768,
+    3, 953, 776, 769, 2, 953, 834, 3, 953, 776, 834, 2, 921, 774, 2, 921,
+    772, 2, 921, 768, 2, 921, 769, 2, 8190, 768, 2, 8190, 769, 2, 8190, 834,
+    2, 965, 774, 2, 965, 772, 3, 965, 776, 768, 3, 965, 776, 769, 2, 961,
+    787, 2, 961, 788, 2, 965, 834, 3, 965, 776, 834, 2, 933, 774, 2, 933,
+    772, 2, 933, 768, 2, 933, 769, 2, 929, 788, 2, 168, 768, 2, 168, 769,
+    1, 96, 3, 969, 768, 837, 2, 969, 837, 3, 969, 769, 837, 2, 969, 834,
+    3, 969, 834, 837, 2, 927, 768, 2, 927, 769, 2, 937, 768, 2, 937, 769,
+    2, 937, 837, 1, 180, 1, 8194, 1, 8195, 1, 937, 1, 75, 2, 65, 778,
+    2, 8592, 824, 2, 8594, 824, 2, 8596, 824, 2, 8656, 824, 2, 8660, 824, 2,
+    8658, 824, 2, 8707, 824, 2, 8712, 824, 2, 8715, 824, 2, 8739, 824, 2, 8741,
+    824, 2, 8764, 824, 2, 8771, 824, 2, 8773, 824, 2, 8776, 824, 2, 61, 824,
+    2, 8801, 824, 2, 8781, 824, 2, 60, 824, 2, 62, 824, 2, 8804, 824, 2,
+    8805, 824, 2, 8818, 824, 2, 8819, 824, 2, 8822, 824, 2, 8823, 824, 2, 8826,
+    824, 2, 8827, 824, 2, 8834, 824, 2, 8835, 824, 2, 8838, 824, 2, 8839, 824,
+    2, 8866, 824, 2, 8872, 824, 2, 8873, 824, 2, 8875, 824, 2, 8828, 824, 2,
+    8829, 824, 2, 8849, 824, 2, 8850, 824, 2, 8882, 824, 2, 8883, 824, 2, 8884,
+    824, 2, 8885, 824, 1, 12296, 1, 12297, 2, 10973, 824, 2, 12363, 12441, 2, 12365,
+    12441, 2, 12367, 12441, 2, 12369, 12441, 2, 12371, 12441, 2, 12373, 12441, 2, 12375, 12441,
+    2, 12377, 12441, 2, 12379, 12441, 2, 12381, 12441, 2, 12383, 12441, 2, 12385, 12441, 2,
+    12388, 12441, 2, 12390, 12441, 2, 12392, 12441, 2, 12399, 12441, 2, 12399, 12442, 2, 12402,
+    12441, 2, 12402, 12442, 2, 12405, 12441, 2, 12405, 12442, 2, 12408, 12441, 2, 12408, 12442,
+    2, 12411, 12441, 2, 12411, 12442, 2, 12358, 12441, 2, 12445, 12441, 2, 12459, 12441, 2,
+    12461, 12441, 2, 12463, 12441, 2, 12465, 12441, 2, 12467, 12441, 2, 12469, 12441, 2, 12471,
+    12441, 2, 12473, 12441, 2, 12475, 12441, 2, 12477, 12441, 2, 12479, 12441, 2, 12481, 12441,
+    2, 12484, 12441, 2, 12486, 12441, 2, 12488, 12441, 2, 12495, 12441, 2, 12495, 12442, 2,
+    12498, 12441, 2, 12498, 12442, 2, 12501, 12441, 2, 12501, 12442, 2, 12504, 12441, 2, 12504,
+    12442, 2, 12507, 12441, 2, 12507, 12442, 2, 12454, 12441, 2, 12527, 12441, 2, 12528, 12441,
+    2, 12529, 12441, 2, 12530, 12441, 2, 12541, 12441, 1, 35912, 1, 26356, 1, 36554, 1,
+    36040, 1, 28369, 1, 20018, 1, 21477, 1, 40860, 1, 40860, 1, 22865, 1, 37329, 1,
+    21895, 1, 22856, 1, 25078, 1, 30313, 1, 32645, 1, 34367, 1, 34746, 1, 35064, 1,
+    37007, 1, 27138, 1, 27931, 1, 28889, 1, 29662, 1, 33853, 1, 37226, 1, 39409, 1,
+    20098, 1, 21365, 1, 27396, 1, 29211, 1, 34349, 1, 40478, 1, 23888, 1, 28651, 1,
+    34253, 1, 35172, 1, 25289, 1, 33240, 1, 34847, 1, 24266, 1, 26391, 1, 28010, 1,
+    29436, 1, 37070, 1, 20358, 1, 20919, 1, 21214, 1, 25796, 1, 27347, 1, 29200, 1,
+    30439, 1, 32769, 1, 34310, 1, 34396, 1, 36335, 1, 38706, 1, 39791, 1, 40442, 1,
+    30860, 1, 31103, 1, 32160, 1, 33737, 1, 37636, 1, 40575, 1, 35542, 1, 22751, 1,
+    24324, 1, 31840, 1, 32894, 1, 29282, 1, 30922, 1, 36034, 1, 38647, 1, 22744, 1,
+    23650, 1, 27155, 1, 28122, 1, 28431, 1, 32047, 1, 32311, 1, 38475, 1, 21202, 1,
+    32907, 1, 20956, 1, 20940, 1, 31260, 1, 32190, 1, 33777, 1, 38517, 1, 35712, 1,
+    25295, 1, 27138, 1, 35582, 1, 20025, 1, 23527, 1, 24594, 1, 29575, 1, 30064, 1,
+    21271, 1, 30971, 1, 20415, 1, 24489, 1, 19981, 1, 27852, 1, 25976, 1, 32034, 1,
+    21443, 1, 22622, 1, 30465, 1, 33865, 1, 35498, 1, 27578, 1, 36784, 1, 27784, 1,
+    25342, 1, 33509, 1, 25504, 1, 30053, 1, 20142, 1, 20841, 1, 20937, 1, 26753, 1,
+    31975, 1, 33391, 1, 35538, 1, 37327, 1, 21237, 1, 21570, 1, 22899, 1, 24300, 1,
+    26053, 1, 28670, 1, 31018, 1, 38317, 1, 39530, 1, 40599, 1, 40654, 1, 21147, 1,
+    26310, 1, 27511, 1, 36706, 1, 24180, 1, 24976, 1, 25088, 1, 25754, 1, 28451, 1,
+    29001, 1, 29833, 1, 31178, 1, 32244, 1, 32879, 1, 36646, 1, 34030, 1, 36899, 1,
+    37706, 1, 21015, 1, 21155, 1, 21693, 1, 28872, 1, 35010, 1, 35498, 1, 24265, 1,
+    24565, 1, 25467, 1, 27566, 1, 31806, 1, 29557, 1, 20196, 1, 22265, 1, 23527, 1,
+    23994, 1, 24604, 1, 29618, 1, 29801, 1, 32666, 1, 32838, 1, 37428, 1, 38646, 1,
+    38728, 1, 38936, 1, 20363, 1, 31150, 1, 37300, 1, 38584, 1, 24801, 1, 20102, 1,
+    20698, 1, 23534, 1, 23615, 1, 26009, 1, 27138, 1, 29134, 1, 30274, 1, 34044, 1,
+    36988, 1, 40845, 1, 26248, 1, 38446, 1, 21129, 1, 26491, 1, 26611, 1, 27969, 1,
+    28316, 1, 29705, 1, 30041, 1, 30827, 1, 32016, 1, 39006, 1, 20845, 1, 25134, 1,
+    38520, 1, 20523, 1, 23833, 1, 28138, 1, 36650, 1, 24459, 1, 24900, 1, 26647, 1,
+    29575, 1, 38534, 1, 21033, 1, 21519, 1, 23653, 1, 26131, 1, 26446, 1, 26792, 1,
+    27877, 1, 29702, 1, 30178, 1, 32633, 1, 35023, 1, 35041, 1, 37324, 1, 38626, 1,
+    21311, 1, 28346, 1, 21533, 1, 29136, 1, 29848, 1, 34298, 1, 38563, 1, 40023, 1,
+    40607, 1, 26519, 1, 28107, 1, 33256, 1, 31435, 1, 31520, 1, 31890, 1, 29376, 1,
+    28825, 1, 35672, 1, 20160, 1, 33590, 1, 21050, 1, 20999, 1, 24230, 1, 25299, 1,
+    31958, 1, 23429, 1, 27934, 1, 26292, 1, 36667, 1, 34892, 1, 38477, 1, 35211, 1,
+    24275, 1, 20800, 1, 21952, 1, 22618, 1, 26228, 1, 20958, 1, 29482, 1, 30410, 1,
+    31036, 1, 31070, 1, 31077, 1, 31119, 1, 38742, 1, 31934, 1, 32701, 1, 34322, 1,
+    35576, 1, 36920, 1, 37117, 1, 39151, 1, 39164, 1, 39208, 1, 40372, 1, 37086, 1,
+    38583, 1, 20398, 1, 20711, 1, 20813, 1, 21193, 1, 21220, 1, 21329, 1, 21917, 1,
+    22022, 1, 22120, 1, 22592, 1, 22696, 1, 23652, 1, 23662, 1, 24724, 1, 24936, 1,
+    24974, 1, 25074, 1, 25935, 1, 26082, 1, 26257, 1, 26757, 1, 28023, 1, 28186, 1,
+    28450, 1, 29038, 1, 29227, 1, 29730, 1, 30865, 1, 31038, 1, 31049, 1, 31048, 1,
+    31056, 1, 31062, 1, 31069, 1, 31117, 1, 31118, 1, 31296, 1, 31361, 1, 31680, 1,
+    32244, 1, 32265, 1, 32321, 1, 32626, 1, 32773, 1, 33261, 1, 33401, 1, 33401, 1,
+    33879, 1, 35088, 1, 35222, 1, 35585, 1, 35641, 1, 36051, 1, 36104, 1, 36790, 1,
+    36920, 1, 38627, 1, 38911, 1, 38971, 1, 24693, 1, 148206, 1, 33304, 1, 20006, 1,
+    20917, 1, 20840, 1, 20352, 1, 20805, 1, 20864, 1, 21191, 1, 21242, 1, 21917, 1,
+    21845, 1, 21913, 1, 21986, 1, 22618, 1, 22707, 1, 22852, 1, 22868, 1, 23138, 1,
+    23336, 1, 24274, 1, 24281, 1, 24425, 1, 24493, 1, 24792, 1, 24910, 1, 24840, 1,
+    24974, 1, 24928, 1, 25074, 1, 25140, 1, 25540, 1, 25628, 1, 25682, 1, 25942, 1,
+    26228, 1, 26391, 1, 26395, 1, 26454, 1, 27513, 1, 27578, 1, 27969, 1, 28379, 1,
+    28363, 1, 28450, 1, 28702, 1, 29038, 1, 30631, 1, 29237, 1, 29359, 1, 29482, 1,
+    29809, 1, 29958, 1, 30011, 1, 30237, 1, 30239, 1, 30410, 1, 30427, 1, 30452, 1,
+    30538, 1, 30528, 1, 30924, 1, 31409, 1, 31680, 1, 31867, 1, 32091, 1, 32244, 1,
+    32574, 1, 32773, 1, 33618, 1, 33775, 1, 34681, 1, 35137, 1, 35206, 1, 35222, 1,
+    35519, 1, 35576, 1, 35531, 1, 35585, 1, 35582, 1, 35565, 1, 35641, 1, 35722, 1,
+    36104, 1, 36664, 1, 36978, 1, 37273, 1, 37494, 1, 38524, 1, 38627, 1, 38742, 1,
+    38875, 1, 38911, 1, 38923, 1, 38971, 1, 39698, 1, 40860, 1, 141386, 1, 141380, 1,
+    144341, 1, 15261, 1, 16408, 1, 16441, 1, 152137, 1, 154832, 1, 163539, 1, 40771, 1,
+    40846, 2, 1497, 1460, 2, 1522, 1463, 2, 1513, 1473, 2, 1513, 1474, 3, 1513, 1468,
+    1473, 3, 1513, 1468, 1474, 2, 1488, 1463, 2, 1488, 1464, 2, 1488, 1468, 2, 1489,
+    1468, 2, 1490, 1468, 2, 1491, 1468, 2, 1492, 1468, 2, 1493, 1468, 2, 1494, 1468,
+    2, 1496, 1468, 2, 1497, 1468, 2, 1498, 1468, 2, 1499, 1468, 2, 1500, 1468, 2,
+    1502, 1468, 2, 1504, 1468, 2, 1505, 1468, 2, 1507, 1468, 2, 1508, 1468, 2, 1510,
+    1468, 2, 1511, 1468, 2, 1512, 1468, 2, 1513, 1468, 2, 1514, 1468, 2, 1493, 1465,
+    2, 1489, 1471, 2, 1499, 1471, 2, 1508, 1471, 2, 69785, 69818, 2, 69787, 69818, 2,
+    69797, 69818, 2, 69937, 69927, 2, 69938, 69927, 2, 70471, 70462, 2, 70471, 70487, 2, 70841,
+    70842, 2, 70841, 70832, 2, 70841, 70845, 2, 71096, 71087, 2, 71097, 71087, 2, 71989, 71984,
+    2, 119127, 119141, 2, 119128, 119141, 3, 119128, 119141, 119150, 3, 119128, 119141, 119151, 3, 119128,
+    119141, 119152, 3, 119128, 119141, 119153, 3, 119128, 119141, 119154, 2, 119225, 119141, 2, 119226, 119141,
+    3, 119225, 119141, 119150, 3, 119226, 119141, 119150, 3, 119225, 119141, 119151, 3, 119226, 119141, 119151,
+    1, 20029, 1, 20024, 1, 20033, 1, 131362, 1, 20320, 1, 20398, 1, 20411, 1, 20482,
+    1, 20602, 1, 20633, 1, 20711, 1, 20687, 1, 13470, 1, 132666, 1, 20813, 1, 20820,
+    1, 20836, 1, 20855, 1, 132380, 1, 13497, 1, 20839, 1, 20877, 1, 132427, 1, 20887,
+    1, 20900, 1, 20172, 1, 20908, 1, 20917, 1, 168415, 1, 20981, 1, 20995, 1, 13535,
+    1, 21051, 1, 21062, 1, 21106, 1, 21111, 1, 13589, 1, 21191, 1, 21193, 1, 21220,
+    1, 21242, 1, 21253, 1, 21254, 1, 21271, 1, 21321, 1, 21329, 1, 21338, 1, 21363,
+    1, 21373, 1, 21375, 1, 21375, 1, 21375, 1, 133676, 1, 28784, 1, 21450, 1, 21471,
+    1, 133987, 1, 21483, 1, 21489, 1, 21510, 1, 21662, 1, 21560, 1, 21576, 1, 21608,
+    1, 21666, 1, 21750, 1, 21776, 1, 21843, 1, 21859, 1, 21892, 1, 21892, 1, 21913,
+    1, 21931, 1, 21939, 1, 21954, 1, 22294, 1, 22022, 1, 22295, 1, 22097, 1, 22132,
+    1, 20999, 1, 22766, 1, 22478, 1, 22516, 1, 22541, 1, 22411, 1, 22578, 1, 22577,
+    1, 22700, 1, 136420, 1, 22770, 1, 22775, 1, 22790, 1, 22810, 1, 22818, 1, 22882,
+    1, 136872, 1, 136938, 1, 23020, 1, 23067, 1, 23079, 1, 23000, 1, 23142, 1, 14062,
+    1, 14076, 1, 23304, 1, 23358, 1, 23358, 1, 137672, 1, 23491, 1, 23512, 1, 23527,
+    1, 23539, 1, 138008, 1, 23551, 1, 23558, 1, 24403, 1, 23586, 1, 14209, 1, 23648,
+    1, 23662, 1, 23744, 1, 23693, 1, 138724, 1, 23875, 1, 138726, 1, 23918, 1, 23915,
+    1, 23932, 1, 24033, 1, 24034, 1, 14383, 1, 24061, 1, 24104, 1, 24125, 1, 24169,
+    1, 14434, 1, 139651, 1, 14460, 1, 24240, 1, 24243, 1, 24246, 1, 24266, 1, 172946,
+    1, 24318, 1, 140081, 1, 140081, 1, 33281, 1, 24354, 1, 24354, 1, 14535, 1, 144056,
+    1, 156122, 1, 24418, 1, 24427, 1, 14563, 1, 24474, 1, 24525, 1, 24535, 1, 24569,
+    1, 24705, 1, 14650, 1, 14620, 1, 24724, 1, 141012, 1, 24775, 1, 24904, 1, 24908,
+    1, 24910, 1, 24908, 1, 24954, 1, 24974, 1, 25010, 1, 24996, 1, 25007, 1, 25054,
+    1, 25074, 1, 25078, 1, 25104, 1, 25115, 1, 25181, 1, 25265, 1, 25300, 1, 25424,
+    1, 142092, 1, 25405, 1, 25340, 1, 25448, 1, 25475, 1, 25572, 1, 142321, 1, 25634,
+    1, 25541, 1, 25513, 1, 14894, 1, 25705, 1, 25726, 1, 25757, 1, 25719, 1, 14956,
+    1, 25935, 1, 25964, 1, 143370, 1, 26083, 1, 26360, 1, 26185, 1, 15129, 1, 26257,
+    1, 15112, 1, 15076, 1, 20882, 1, 20885, 1, 26368, 1, 26268, 1, 32941, 1, 17369,
+    1, 26391, 1, 26395, 1, 26401, 1, 26462, 1, 26451, 1, 144323, 1, 15177, 1, 26618,
+    1, 26501, 1, 26706, 1, 26757, 1, 144493, 1, 26766, 1, 26655, 1, 26900, 1, 15261,
+    1, 26946, 1, 27043, 1, 27114, 1, 27304, 1, 145059, 1, 27355, 1, 15384, 1, 27425,
+    1, 145575, 1, 27476, 1, 15438, 1, 27506, 1, 27551, 1, 27578, 1, 27579, 1, 146061,
+    1, 138507, 1, 146170, 1, 27726, 1, 146620, 1, 27839, 1, 27853, 1, 27751, 1, 27926,
+    1, 27966, 1, 28023, 1, 27969, 1, 28009, 1, 28024, 1, 28037, 1, 146718, 1, 27956,
+    1, 28207, 1, 28270, 1, 15667, 1, 28363, 1, 28359, 1, 147153, 1, 28153, 1, 28526,
+    1, 147294, 1, 147342, 1, 28614, 1, 28729, 1, 28702, 1, 28699, 1, 15766, 1, 28746,
+    1, 28797, 1, 28791, 1, 28845, 1, 132389, 1, 28997, 1, 148067, 1, 29084, 1, 148395,
+    1, 29224, 1, 29237, 1, 29264, 1, 149000, 1, 29312, 1, 29333, 1, 149301, 1, 149524,
+    1, 29562, 1, 29579, 1, 16044, 1, 29605, 1, 16056, 1, 16056, 1, 29767, 1, 29788,
+    1, 29809, 1, 29829, 1, 29898, 1, 16155, 1, 29988, 1, 150582, 1, 30014, 1, 150674,
+    1, 30064, 1, 139679, 1, 30224, 1, 151457, 1, 151480, 1, 151620, 1, 16380, 1, 16392,
+    1, 30452, 1, 151795, 1, 151794, 1, 151833, 1, 151859, 1, 30494, 1, 30495, 1, 30495,
+    1, 30538, 1, 16441, 1, 30603, 1, 16454, 1, 16534, 1, 152605, 1, 30798, 1, 30860,
+    1, 30924, 1, 16611, 1, 153126, 1, 31062, 1, 153242, 1, 153285, 1, 31119, 1, 31211,
+    1, 16687, 1, 31296, 1, 31306, 1, 31311, 1, 153980, 1, 154279, 1, 154279, 1, 31470,
+    1, 16898, 1, 154539, 1, 31686, 1, 31689, 1, 16935, 1, 154752, 1, 31954, 1, 17056,
+    1, 31976, 1, 31971, 1, 32000, 1, 155526, 1, 32099, 1, 17153, 1, 32199, 1, 32258,
+    1, 32325, 1, 17204, 1, 156200, 1, 156231, 1, 17241, 1, 156377, 1, 32634, 1, 156478,
+    1, 32661, 1, 32762, 1, 32773, 1, 156890, 1, 156963, 1, 32864, 1, 157096, 1, 32880,
+    1, 144223, 1, 17365, 1, 32946, 1, 33027, 1, 17419, 1, 33086, 1, 23221, 1, 157607,
+    1, 157621, 1, 144275, 1, 144284, 1, 33281, 1, 33284, 1, 36766, 1, 17515, 1, 33425,
+    1, 33419, 1, 33437, 1, 21171, 1, 33457, 1, 33459, 1, 33469, 1, 33510, 1, 158524,
+    1, 33509, 1, 33565, 1, 33635, 1, 33709, 1, 33571, 1, 33725, 1, 33767, 1, 33879,
+    1, 33619, 1, 33738, 1, 33740, 1, 33756, 1, 158774, 1, 159083, 1, 158933, 1, 17707,
+    1, 34033, 1, 34035, 1, 34070, 1, 160714, 1, 34148, 1, 159532, 1, 17757, 1, 17761,
+    1, 159665, 1, 159954, 1, 17771, 1, 34384, 1, 34396, 1, 34407, 1, 34409, 1, 34473,
+    1, 34440, 1, 34574, 1, 34530, 1, 34681, 1, 34600, 1, 34667, 1, 34694, 1, 17879,
+    1, 34785, 1, 34817, 1, 17913, 1, 34912, 1, 34915, 1, 161383, 1, 35031, 1, 35038,
+    1, 17973, 1, 35066, 1, 13499, 1, 161966, 1, 162150, 1, 18110, 1, 18119, 1, 35488,
+    1, 35565, 1, 35722, 1, 35925, 1, 162984, 1, 36011, 1, 36033, 1, 36123, 1, 36215,
+    1, 163631, 1, 133124, 1, 36299, 1, 36284, 1, 36336, 1, 133342, 1, 36564, 1, 36664,
+    1, 165330, 1, 165357, 1, 37012, 1, 37105, 1, 37137, 1, 165678, 1, 37147, 1, 37432,
+    1, 37591, 1, 37592, 1, 37500, 1, 37881, 1, 37909, 1, 166906, 1, 38283, 1, 18837,
+    1, 38327, 1, 167287, 1, 18918, 1, 38595, 1, 23986, 1, 38691, 1, 168261, 1, 168474,
+    1, 19054, 1, 19062, 1, 38880, 1, 168970, 1, 19122, 1, 169110, 1, 38923, 1, 38923,
+    1, 38953, 1, 169398, 1, 39138, 1, 19251, 1, 39209, 1, 39335, 1, 39362, 1, 39422,
+    1, 19406, 1, 170800, 1, 39698, 1, 40000, 1, 40189, 1, 19662, 1, 19693, 1, 40295,
+    1, 172238, 1, 19704, 1, 172293, 1, 172558, 1, 172689, 1, 40635, 1, 19798, 1, 40697,
+    1, 40702, 1, 40709, 1, 40719, 1, 40726, 1, 40763, 1, 173568,
+];
+pub const COMBINING_CLASS_LIMIT: u32 = 0x1E980;
+pub static COMBINING_CLASS_INDEX: [u16; 979] = [
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 12, 12, 13, 14, 12, 15, 16, 17, 18, 19, 20,
+    21, 22, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 24, 25,
+    0, 26, 27, 0, 28, 29, 30, 31, 32, 33, 0, 34, 0, 0, 0, 0,
+    0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 37, 38, 0, 0, 0, 0,
+    39, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0,
+    43, 44, 45, 46, 0, 47, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 50, 0, 0, 0,
+    0, 0, 0, 51, 0, 52, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 56, 0, 0, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 0, 67, 68, 0, 69, 70, 71, 72, 0,
+    61, 0, 73, 74, 75, 76, 0, 0, 70, 0, 77, 78, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 79, 80, 0, 0, 0, 0, 0, 0, 0, 0, 81,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 83, 84, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    86, 0, 80, 0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 88, 89,
+];
+pub static COMBINING_CLASS_BLOCKS: [u8; 11520] = [
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 232, 220, 220, 220, 220, 232, 216, 220, 220, 220, 220,
+    220, 202, 202, 220, 220, 220, 220, 202, 202, 220, 220, 220, 220, 220, 220, 220,
+    220, 220, 220, 220, 1, 1, 1, 1, 1, 220, 220, 220, 220, 230, 230, 230,
+    230, 230, 230, 230, 230, 240, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0,
+    230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230, 233, 234, 234, 233,
+    234, 234, 233, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 230, 230, 230, 230, 220, 230, 230, 230, 222, 220, 230, 230, 230, 230,
+    230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 230, 230, 222, 228, 230,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23,
+    0, 24, 25, 0, 230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31,
+    32, 33, 34, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230,
+    230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220, 230, 230, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+    230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 0, 230, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220,
+    220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 0, 220, 230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220,
+    27, 28, 29, 230, 230, 230, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 230, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 84, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 129, 130, 0, 132, 0, 0, 0, 0, 0, 130, 130, 130, 130, 0, 0,
+    130, 0, 230, 230, 9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220,
+    220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230,
+    230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230, 230, 220, 220, 220, 220,
+    230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220,
+    202, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230, 233, 220, 230, 220,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 1, 1, 230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0,
+    0, 230, 0, 0, 0, 1, 1, 230, 220, 230, 1, 1, 220, 220, 220, 220,
+    230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 0, 230, 230, 220, 0, 0, 230, 230, 0, 0, 0, 0, 0, 230, 230,
+    0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 220, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220, 230, 220, 220, 220,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 220, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0,
+    230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 216, 216, 1, 1, 1, 0, 0, 0, 226, 216, 216,
+    216, 216, 216, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220, 220,
+    220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    220, 220, 220, 220, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+];
+pub static COMPOSITIONS: [(u32, u32, u32); 941] = [
+    (0x3C, 0x338, 0x226E),
+    (0x3D, 0x338, 0x2260),
+    (0x3E, 0x338, 0x226F),
+    (0x41, 0x300, 0xC0),
+    (0x41, 0x301, 0xC1),
+    (0x41, 0x302, 0xC2),
+    (0x41, 0x303, 0xC3),
+    (0x41, 0x304, 0x100),
+    (0x41, 0x306, 0x102),
+    (0x41, 0x307, 0x226),
+    (0x41, 0x308, 0xC4),
+    (0x41, 0x309, 0x1EA2),
+    (0x41, 0x30A, 0xC5),
+    (0x41, 0x30C, 0x1CD),
+    (0x41, 0x30F, 0x200),
+    (0x41, 0x311, 0x202),
+    (0x41, 0x323, 0x1EA0),
+    (0x41, 0x325, 0x1E00),
+    (0x41, 0x328, 0x104),
+    (0x42, 0x307, 0x1E02),
+    (0x42, 0x323, 0x1E04),
+    (0x42, 0x331, 0x1E06),
+    (0x43, 0x301, 0x106),
+    (0x43, 0x302, 0x108),
+    (0x43, 0x307, 0x10A),
+    (0x43, 0x30C, 0x10C),
+    (0x43, 0x327, 0xC7),
+    (0x44, 0x307, 0x1E0A),
+    (0x44, 0x30C, 0x10E),
+    (0x44, 0x323, 0x1E0C),
+    (0x44, 0x327, 0x1E10),
+    (0x44, 0x32D, 0x1E12),
+    (0x44, 0x331, 0x1E0E),
+    (0x45, 0x300, 0xC8),
+    (0x45, 0x301, 0xC9),
+    (0x45, 0x302, 0xCA),
+    (0x45, 0x303, 0x1EBC),
+    (0x45, 0x304, 0x112),
+    (0x45, 0x306, 0x114),
+    (0x45, 0x307, 0x116),
+    (0x45, 0x308, 0xCB),
+    (0x45, 0x309, 0x1EBA),
+    (0x45, 0x30C, 0x11A),
+    (0x45, 0x30F, 0x204),
+    (0x45, 0x311, 0x206),
+    (0x45, 0x323, 0x1EB8),
+    (0x45, 0x327, 0x228),
+    (0x45, 0x328, 0x118),
+    (0x45, 0x32D, 0x1E18),
+    (0x45, 0x330, 0x1E1A),
+    (0x46, 0x307, 0x1E1E),
+    (0x47, 0x301, 0x1F4),
+    (0x47, 0x302, 0x11C),
+    (0x47, 0x304, 0x1E20),
+    (0x47, 0x306, 0x11E),
+    (0x47, 0x307, 0x120),
+    (0x47, 0x30C, 0x1E6),
+    (0x47, 0x327, 0x122),
+    (0x48, 0x302, 0x124),
+    (0x48, 0x307, 0x1E22),
+    (0x48, 0x308, 0x1E26),
+    (0x48, 0x30C, 0x21E),
+    (0x48, 0x323, 0x1E24),
+    (0x48, 0x327, 0x1E28),
+    (0x48, 0x32E, 0x1E2A),
+    (0x49, 0x300, 0xCC),
+    (0x49, 0x301, 0xCD),
+    (0x49, 0x302, 0xCE),
+    (0x49, 0x303, 0x128),
+    (0x49, 0x304, 0x12A),
+    (0x49, 0x306, 0x12C),
+    (0x49, 0x307, 0x130),
+    (0x49, 0x308, 0xCF),
+    (0x49, 0x309, 0x1EC8),
+    (0x49, 0x30C, 0x1CF),
+    (0x49, 0x30F, 0x208),
+    (0x49, 0x311, 0x20A),
+    (0x49, 0x323, 0x1ECA),
+    (0x49, 0x328, 0x12E),
+    (0x49, 0x330, 0x1E2C),
+    (0x4A, 0x302, 0x134),
+    (0x4B, 0x301, 0x1E30),
+    (0x4B, 0x30C, 0x1E8),
+    (0x4B, 0x323, 0x1E32),
+    (0x4B, 0x327, 0x136),
+    (0x4B, 0x331, 0x1E34),
+    (0x4C, 0x301, 0x139),
+    (0x4C, 0x30C, 0x13D),
+    (0x4C, 0x323, 0x1E36),
+    (0x4C, 0x327, 0x13B),
+    (0x4C, 0x32D, 0x1E3C),
+    (0x4C, 0x331, 0x1E3A),
+    (0x4D, 0x301, 0x1E3E),
+    (0x4D, 0x307, 0x1E40),
+    (0x4D, 0x323, 0x1E42),
+    (0x4E, 0x300, 0x1F8),
+    (0x4E, 0x301, 0x143),
+    (0x4E, 0x303, 0xD1),
+    (0x4E, 0x307, 0x1E44),
+    (0x4E, 0x30C, 0x147),
+    (0x4E, 0x323, 0x1E46),
+    (0x4E, 0x327, 0x145),
+    (0x4E, 0x32D, 0x1E4A),
+    (0x4E, 0x331, 0x1E48),
+    (0x4F, 0x300, 0xD2),
+    (0x4F, 0x301, 0xD3),
+    (0x4F, 0x302, 0xD4),
+    (0x4F, 0x303, 0xD5),
+    (0x4F, 0x304, 0x14C),
+    (0x4F, 0x306, 0x14E),
+    (0x4F, 0x307, 0x22E),
+    (0x4F, 0x308, 0xD6),
+    (0x4F, 0x309, 0x1ECE),
+    (0x4F, 0x30B, 0x150),
+    (0x4F, 0x30C, 0x1D1),
+    (0x4F, 0x30F, 0x20C),
+    (0x4F, 0x311, 0x20E),
+    (0x4F, 0x31B, 0x1A0),
+    (0x4F, 0x323, 0x1ECC),
+    (0x4F, 0x328, 0x1EA),
+    (0x50, 0x301, 0x1E54),
+    (0x50, 0x307, 0x1E56),
+    (0x52, 0x301, 0x154),
+    (0x52, 0x307, 0x1E58),
+    (0x52, 0x30C, 0x158),
+    (0x52, 0x30F, 0x210),
+    (0x52, 0x311, 0x212),
+    (0x52, 0x323, 0x1E5A),
+    (0x52, 0x327, 0x156),
+    (0x52, 0x331, 0x1E5E),
+    (0x53, 0x301, 0x15A),
+    (0x53, 0x302, 0x15C),
+    (0x53, 0x307, 0x1E60),
+    (0x53, 0x30C, 0x160),
+    (0x53, 0x323, 0x1E62),
+    (0x53, 0x326, 0x218),
+    (0x53, 0x327, 0x15E),
+    (0x54, 0x307, 0x1E6A),
+    (0x54, 0x30C, 0x164),
+    (0x54, 0x323, 0x1E6C),
+    (0x54, 0x326, 0x21A),
+    (0x54, 0x327, 0x162),
+    (0x54, 0x32D, 0x1E70),
+    (0x54, 0x331, 0x1E6E),
+    (0x55, 0x300, 0xD9),
+    (0x55, 0x301, 0xDA),
+    (0x55, 0x302, 0xDB),
+    (0x55, 0x303, 0x168),
+    (0x55, 0x304, 0x16A),
+    (0x55, 0x306, 0x16C),
+    (0x55, 0x308, 0xDC),
+    (0x55, 0x309, 0x1EE6),
+    (0x55, 0x30A, 0x16E),
+    (0x55, 0x30B, 0x170),
+    (0x55, 0x30C, 0x1D3),
+    (0x55, 0x30F, 0x214),
+    (0x55, 0x311, 0x216),
+    (0x55, 0x31B, 0x1AF),
+    (0x55, 0x323, 0x1EE4),
+    (0x55, 0x324, 0x1E72),
+    (0x55, 0x328, 0x172),
+    (0x55, 0x32D, 0x1E76),
+    (0x55, 0x330, 0x1E74),
+    (0x56, 0x303, 0x1E7C),
+    (0x56, 0x323, 0x1E7E),
+    (0x57, 0x300, 0x1E80),
+    (0x57, 0x301, 0x1E82),
+    (0x57, 0x302, 0x174),
+    (0x57, 0x307, 0x1E86),
+    (0x57, 0x308, 0x1E84),
+    (0x57, 0x323, 0x1E88),
+    (0x58, 0x307, 0x1E8A),
+    (0x58, 0x308, 0x1E8C),
+    (0x59, 0x300, 0x1EF2),
+    (0x59, 0x301, 0xDD),
+    (0x59, 0x302, 0x176),
+    (0x59, 0x303, 0x1EF8),
+    (0x59, 0x304, 0x232),
+    (0x59, 0x307, 0x1E8E),
+    (0x59, 0x308, 0x178),
+    (0x59, 0x309, 0x1EF6),
+    (0x59, 0x323, 0x1EF4),
+    (0x5A, 0x301, 0x179),
+    (0x5A, 0x302, 0x1E90),
+    (0x5A, 0x307, 0x17B),
+    (0x5A, 0x30C, 0x17D),
+    (0x5A, 0x323, 0x1E92),
+    (0x5A, 0x331, 0x1E94),
+    (0x61, 0x300, 0xE0),
+    (0x61, 0x301, 0xE1),
+    (0x61, 0x302, 0xE2),
+    (0x61, 0x303, 0xE3),
+    (0x61, 0x304, 0x101),
+    (0x61, 0x306, 0x103),
+    (0x61, 0x307, 0x227),
+    (0x61, 0x308, 0xE4),
+    (0x61, 0x309, 0x1EA3),
+    (0x61, 0x30A, 0xE5),
+    (0x61, 0x30C, 0x1CE),
+    (0x61, 0x30F, 0x201),
+    (0x61, 0x311, 0x203),
+    (0x61, 0x323, 0x1EA1),
+    (0x61, 0x325, 0x1E01),
+    (0x61, 0x328, 0x105),
+    (0x62, 0x307, 0x1E03),
+    (0x62, 0x323, 0x1E05),
+    (0x62, 0x331, 0x1E07),
+    (0x63, 0x301, 0x107),
+    (0x63, 0x302, 0x109),
+    (0x63, 0x307, 0x10B),
+    (0x63, 0x30C, 0x10D),
+    (0x63, 0x327, 0xE7),
+    (0x64, 0x307, 0x1E0B),
+    (0x64, 0x30C, 0x10F),
+    (0x64, 0x323, 0x1E0D),
+    (0x64, 0x327, 0x1E11),
+    (0x64, 0x32D, 0x1E13),
+    (0x64, 0x331, 0x1E0F),
+    (0x65, 0x300, 0xE8),
+    (0x65, 0x301, 0xE9),
+    (0x65, 0x302, 0xEA),
+    (0x65, 0x303, 0x1EBD),
+    (0x65, 0x304, 0x113),
+    (0x65, 0x306, 0x115),
+    (0x65, 0x307, 0x117),
+    (0x65, 0x308, 0xEB),
+    (0x65, 0x309, 0x1EBB),
+    (0x65, 0x30C, 0x11B),
+    (0x65, 0x30F, 0x205),
+    (0x65, 0x311, 0x207),
+    (0x65, 0x323, 0x1EB9),
+    (0x65, 0x327, 0x229),
+    (0x65, 0x328, 0x119),
+    (0x65, 0x32D, 0x1E19),
+    (0x65, 0x330, 0x1E1B),
+    (0x66, 0x307, 0x1E1F),
+    (0x67, 0x301, 0x1F5),
+    (0x67, 0x302, 0x11D),
+    (0x67, 0x304, 0x1E21),
+    (0x67, 0x306, 0x11F),
+    (0x67, 0x307, 0x121),
+    (0x67, 0x30C, 0x1E7),
+    (0x67, 0x327, 0x123),
+    (0x68, 0x302, 0x125),
+    (0x68, 0x307, 0x1E23),
+    (0x68, 0x308, 0x1E27),
+    (0x68, 0x30C, 0x21F),
+    (0x68, 0x323, 0x1E25),
+    (0x68, 0x327, 0x1E29),
+    (0x68, 0x32E, 0x1E2B),
+    (0x68, 0x331, 0x1E96),
+    (0x69, 0x300, 0xEC),
+    (0x69, 0x301, 0xED),
+    (0x69, 0x302, 0xEE),
+    (0x69, 0x303, 0x129),
+    (0x69, 0x304, 0x12B),
+    (0x69, 0x306, 0x12D),
+    (0x69, 0x308, 0xEF),
+    (0x69, 0x309, 0x1EC9),
+    (0x69, 0x30C, 0x1D0),
+    (0x69, 0x30F, 0x209),
+    (0x69, 0x311, 0x20B),
+    (0x69, 0x323, 0x1ECB),
+    (0x69, 0x328, 0x12F),
+    (0x69, 0x330, 0x1E2D),
+    (0x6A, 0x302, 0x135),
+    (0x6A, 0x30C, 0x1F0),
+    (0x6B, 0x301, 0x1E31),
+    (0x6B, 0x30C, 0x1E9),
+    (0x6B, 0x323, 0x1E33),
+    (0x6B, 0x327, 0x137),
+    (0x6B, 0x331, 0x1E35),
+    (0x6C, 0x301, 0x13A),
+    (0x6C, 0x30C, 0x13E),
+    (0x6C, 0x323, 0x1E37),
+    (0x6C, 0x327, 0x13C),
+    (0x6C, 0x32D, 0x1E3D),
+    (0x6C, 0x331, 0x1E3B),
+    (0x6D, 0x301, 0x1E3F),
+    (0x6D, 0x307, 0x1E41),
+    (0x6D, 0x323, 0x1E43),
+    (0x6E, 0x300, 0x1F9),
+    (0x6E, 0x301, 0x144),
+    (0x6E, 0x303, 0xF1),
+    (0x6E, 0x307, 0x1E45),
+    (0x6E, 0x30C, 0x148),
+    (0x6E, 0x323, 0x1E47),
+    (0x6E, 0x327, 0x146),
+    (0x6E, 0x32D, 0x1E4B),
+    (0x6E, 0x331, 0x1E49),
+    (0x6F, 0x300, 0xF2),
+    (0x6F, 0x301, 0xF3),
+    (0x6F, 0x302, 0xF4),
+    (0x6F, 0x303, 0xF5),
+    (0x6F, 0x304, 0x14D),
+    (0x6F, 0x306, 0x14F),
+    (0x6F, 0x307, 0x22F),
+    (0x6F, 0x308, 0xF6),
+    (0x6F, 0x309, 0x1ECF),
+    (0x6F, 0x30B, 0x151),
+    (0x6F, 0x30C, 0x1D2),
+    (0x6F, 0x30F, 0x20D),
+    (0x6F, 0x311, 0x20F),
+    (0x6F, 0x31B, 0x1A1),
+    (0x6F, 0x323, 0x1ECD),
+    (0x6F, 0x328, 0x1EB),
+    (0x70, 0x301, 0x1E55),
+    (0x70, 0x307, 0x1E57),
+    (0x72, 0x301, 0x155),
+    (0x72, 0x307, 0x1E59),
+    (0x72, 0x30C, 0x159),
+    (0x72, 0x30F, 0x211),
+    (0x72, 0x311, 0x213),
+    (0x72, 0x323, 0x1E5B),
+    (0x72, 0x327, 0x157),
+    (0x72, 0x331, 0x1E5F),
+    (0x73, 0x301, 0x15B),
+    (0x73, 0x302, 0x15D),
+    (0x73, 0x307, 0x1E61),
+    (0x73, 0x30C, 0x161),
+    (0x73, 0x323, 0x1E63),
+    (0x73, 0x326, 0x219),
+    (0x73, 0x327, 0x15F),
+    (0x74, 0x307, 0x1E6B),
+    (0x74, 0x308, 0x1E97),
+    (0x74, 0x30C, 0x165),
+    (0x74, 0x323, 0x1E6D),
+    (0x74, 0x326, 0x21B),
+    (0x74, 0x327, 0x163),
+    (0x74, 0x32D, 0x1E71),
+    (0x74, 0x331, 0x1E6F),
+    (0x75, 0x300, 0xF9),
+    (0x75, 0x301, 0xFA),
+    (0x75, 0x302, 0xFB),
+    (0x75, 0x303, 0x169),
+    (0x75, 0x304, 0x16B),
+    (0x75, 0x306, 0x16D),
+    (0x75, 0x308, 0xFC),
+    (0x75, 0x309, 0x1EE7),
+    (0x75, 0x30A, 0x16F),
+    (0x75, 0x30B, 0x171),
+    (0x75, 0x30C, 0x1D4),
+    (0x75, 0x30F, 0x215),
+    (0x75, 0x311, 0x217),
+    (0x75, 0x31B, 0x1B0),
+    (0x75, 0x323, 0x1EE5),
+    (0x75, 0x324, 0x1E73),
+    (0x75, 0x328, 0x173),
+    (0x75, 0x32D, 0x1E77),
+    (0x75, 0x330, 0x1E75),
+    (0x76, 0x303, 0x1E7D),
+    (0x76, 0x323, 0x1E7F),
+    (0x77, 0x300, 0x1E81),
+    (0x77, 0x301, 0x1E83),
+    (0x77, 0x302, 0x175),
+    (0x77, 0x307, 0x1E87),
+    (0x77, 0x308, 0x1E85),
+    (0x77, 0x30A, 0x1E98),
+    (0x77, 0x323, 0x1E89),
+    (0x78, 0x307, 0x1E8B),
+    (0x78, 0x308, 0x1E8D),
+    (0x79, 0x300, 0x1EF3),
+    (0x79, 0x301, 0xFD),
+    (0x79, 0x302, 0x177),
+    (0x79, 0x303, 0x1EF9),
+    (0x79, 0x304, 0x233),
+    (0x79, 0x307, 0x1E8F),
+    (0x79, 0x308, 0xFF),
+    (0x79, 0x309, 0x1EF7),
+    (0x79, 0x30A, 0x1E99),
+    (0x79, 0x323, 0x1EF5),
+    (0x7A, 0x301, 0x17A),
+    (0x7A, 0x302, 0x1E91),
+    (0x7A, 0x307, 0x17C),
+    (0x7A, 0x30C, 0x17E),
+    (0x7A, 0x323, 0x1E93),
+    (0x7A, 0x331, 0x1E95),
+    (0xA8, 0x300, 0x1FED),
+    (0xA8, 0x301, 0x385),
+    (0xA8, 0x342, 0x1FC1),
+    (0xC2, 0x300, 0x1EA6),
+    (0xC2, 0x301, 0x1EA4),
+    (0xC2, 0x303, 0x1EAA),
+    (0xC2, 0x309, 0x1EA8),
+    (0xC4, 0x304, 0x1DE),
+    (0xC5, 0x301, 0x1FA),
+    (0xC6, 0x301, 0x1FC),
+    (0xC6, 0x304, 0x1E2),
+    (0xC7, 0x301, 0x1E08),
+    (0xCA, 0x300, 0x1EC0),
+    (0xCA, 0x301, 0x1EBE),
+    (0xCA, 0x303, 0x1EC4),
+    (0xCA, 0x309, 0x1EC2),
+    (0xCF, 0x301, 0x1E2E),
+    (0xD4, 0x300, 0x1ED2),
+    (0xD4, 0x301, 0x1ED0),
+    (0xD4, 0x303, 0x1ED6),
+    (0xD4, 0x309, 0x1ED4),
+    (0xD5, 0x301, 0x1E4C),
+    (0xD5, 0x304, 0x22C),
+    (0xD5, 0x308, 0x1E4E),
+    (0xD6, 0x304, 0x22A),
+    (0xD8, 0x301, 0x1FE),
+    (0xDC, 0x300, 0x1DB),
+    (0xDC, 0x301, 0x1D7),
+    (0xDC, 0x304, 0x1D5),
+    (0xDC, 0x30C, 0x1D9),
+    (0xE2, 0x300, 0x1EA7),
+    (0xE2, 0x301, 0x1EA5),
+    (0xE2, 0x303, 0x1EAB),
+    (0xE2, 0x309, 0x1EA9),
+    (0xE4, 0x304, 0x1DF),
+    (0xE5, 0x301, 0x1FB),
+    (0xE6, 0x301, 0x1FD),
+    (0xE6, 0x304, 0x1E3),
+    (0xE7, 0x301, 0x1E09),
+    (0xEA, 0x300, 0x1EC1),
+    (0xEA, 0x301, 0x1EBF),
+    (0xEA, 0x303, 0x1EC5),
+    (0xEA, 0x309, 0x1EC3),
+    (0xEF, 0x301, 0x1E2F),
+    (0xF4, 0x300, 0x1ED3),
+    (0xF4, 0x301, 0x1ED1),
+    (0xF4, 0x303, 0x1ED7),
+    (0xF4, 0x309, 0x1ED5),
+    (0xF5, 0x301, 0x1E4D),
+    (0xF5, 0x304, 0x22D),
+    (0xF5, 0x308, 0x1E4F),
+    (0xF6, 0x304, 0x22B),
+    (0xF8, 0x301, 0x1FF),
+    (0xFC, 0x300, 0x1DC),
+    (0xFC, 0x301, 0x1D8),
+    (0xFC, 0x304, 0x1D6),
+    (0xFC, 0x30C, 0x1DA),
+    (0x102, 0x300, 0x1EB0),
+    (0x102, 0x301, 0x1EAE),
+    (0x102, 0x303, 0x1EB4),
+    (0x102, 0x309, 0x1EB2),
+    (0x103, 0x300, 0x1EB1),
+    (0x103, 0x301, 0x1EAF),
+    (0x103, 0x303, 0x1EB5),
+    (0x103, 0x309, 0x1EB3),
+    (0x112, 0x300, 0x1E14),
+    (0x112, 0x301, 0x1E16),
+    (0x113, 0x300, 0x1E15),
+    (0x113, 0x301, 0x1E17),
+    (0x14C, 0x300, 0x1E50),
+    (0x14C, 0x301, 0x1E52),
+    (0x14D, 0x300, 0x1E51),
+    (0x14D, 0x301, 0x1E53),
+    (0x15A, 0x307, 0x1E64),
+    (0x15B, 0x307, 0x1E65),
+    (0x160, 0x307, 0x1E66),
+    (0x161, 0x307, 0x1E67),
+    (0x168, 0x301, 0x1E78),
+    (0x169, 0x301, 0x1E79),
+    (0x16A, 0x308, 0x1E7A),
+    (0x16B, 0x308, 0x1E7B),
+    (0x17F, 0x307, 0x1E9B),
+    (0x1A0, 0x300, 0x1EDC),
+    (0x1A0, 0x301, 0x1EDA),
+    (0x1A0, 0x303, 0x1EE0),
+    (0x1A0, 0x309, 0x1EDE),
+    (0x1A0, 0x323, 0x1EE2),
+    (0x1A1, 0x300, 0x1EDD),
+    (0x1A1, 0x301, 0x1EDB),
+    (0x1A1, 0x303, 0x1EE1),
+    (0x1A1, 0x309, 0x1EDF),
+    (0x1A1, 0x323, 0x1EE3),
+    (0x1AF, 0x300, 0x1EEA),
+    (0x1AF, 0x301, 0x1EE8),
+    (0x1AF, 0x303, 0x1EEE),
+    (0x1AF, 0x309, 0x1EEC),
+    (0x1AF, 0x323, 0x1EF0),
+    (0x1B0, 0x300, 0x1EEB),
+    (0x1B0, 0x301, 0x1EE9),
+    (0x1B0, 0x303, 0x1EEF),
+    (0x1B0, 0x309, 0x1EED),
+    (0x1B0, 0x323, 0x1EF1),
+    (0x1B7, 0x30C, 0x1EE),
+    (0x1EA, 0x304, 0x1EC),
+    (0x1EB, 0x304, 0x1ED),
+    (0x226, 0x304, 0x1E0),
+    (0x227, 0x304, 0x1E1),
+    (0x228, 0x306, 0x1E1C),
+    (0x229, 0x306, 0x1E1D),
+    (0x22E, 0x304, 0x230),
+    (0x22F, 0x304, 0x231),
+    (0x292, 0x30C, 0x1EF),
+    (0x391, 0x300, 0x1FBA),
+    (0x391, 0x301, 0x386),
+    (0x391, 0x304, 0x1FB9),
+    (0x391, 0x306, 0x1FB8),
+    (0x391, 0x313, 0x1F08),
+    (0x391, 0x314, 0x1F09),
+    (0x391, 0x345, 0x1FBC),
+    (0x395, 0x300, 0x1FC8),
+    (0x395, 0x301, 0x388),
+    (0x395, 0x313, 0x1F18),
+    (0x395, 0x314, 0x1F19),
+    (0x397, 0x300, 0x1FCA),
+    (0x397, 0x301, 0x389),
+    (0x397, 0x313, 0x1F28),
+    (0x397, 0x314, 0x1F29),
+    (0x397, 0x345, 0x1FCC),
+    (0x399, 0x300, 0x1FDA),
+    (0x399, 0x301, 0x38A),
+    (0x399, 0x304, 0x1FD9),
+    (0x399, 0x306, 0x1FD8),
+    (0x399, 0x308, 0x3AA),
+    (0x399, 0x313, 0x1F38),
+    (0x399, 0x314, 0x1F39),
+    (0x39F, 0x300, 0x1FF8),
+    (0x39F, 0x301, 0x38C),
+    (0x39F, 0x313, 0x1F48),
+    (0x39F, 0x314, 0x1F49),
+    (0x3A1, 0x314, 0x1FEC),
+    (0x3A5, 0x300, 0x1FEA),
+    (0x3A5, 0x301, 0x38E),
+    (0x3A5, 0x304, 0x1FE9),
+    (0x3A5, 0x306, 0x1FE8),
+    (0x3A5, 0x308, 0x3AB),
+    (0x3A5, 0x314, 0x1F59),
+    (0x3A9, 0x300, 0x1FFA),
+    (0x3A9, 0x301, 0x38F),
+    (0x3A9, 0x313, 0x1F68),
+    (0x3A9, 0x314, 0x1F69),
+    (0x3A9, 0x345, 0x1FFC),
+    (0x3AC, 0x345, 0x1FB4),
+    (0x3AE, 0x345, 0x1FC4),
+    (0x3B1, 0x300, 0x1F70),
+    (0x3B1, 0x301, 0x3AC),
+    (0x3B1, 0x304, 0x1FB1),
+    (0x3B1, 0x306, 0x1FB0),
+    (0x3B1, 0x313, 0x1F00),
+    (0x3B1, 0x314, 0x1F01),
+    (0x3B1, 0x342, 0x1FB6),
+    (0x3B1, 0x345, 0x1FB3),
+    (0x3B5, 0x300, 0x1F72),
+    (0x3B5, 0x301, 0x3AD),
+    (0x3B5, 0x313, 0x1F10),
+    (0x3B5, 0x314, 0x1F11),
+    (0x3B7, 0x300, 0x1F74),
+    (0x3B7, 0x301, 0x3AE),
+    (0x3B7, 0x313, 0x1F20),
+    (0x3B7, 0x314, 0x1F21),
+    (0x3B7, 0x342, 0x1FC6),
+    (0x3B7, 0x345, 0x1FC3),
+    (0x3B9, 0x300, 0x1F76),
+    (0x3B9, 0x301, 0x3AF),
+    (0x3B9, 0x304, 0x1FD1),
+    (0x3B9, 0x306, 0x1FD0),
+    (0x3B9, 0x308, 0x3CA),
+    (0x3B9, 0x313, 0x1F30),
+    (0x3B9, 0x314, 0x1F31),
+    (0x3B9, 0x342, 0x1FD6),
+    (0x3BF, 0x300, 0x1F78),
+    (0x3BF, 0x301, 0x3CC),
+    (0x3BF, 0x313, 0x1F40),
+    (0x3BF, 0x314, 0x1F41),
+    (0x3C1, 0x313, 0x1FE4),
+    (0x3C1, 0x314, 0x1FE5),
+    (0x3C5, 0x300, 0x1F7A),
+    (0x3C5, 0x301, 0x3CD),
+    (0x3C5, 0x304, 0x1FE1),
+    (0x3C5, 0x306, 0x1FE0),
+    (0x3C5, 0x308, 0x3CB),
+    (0x3C5, 0x313, 0x1F50),
+    (0x3C5, 0x314, 0x1F51),
+    (0x3C5, 0x342, 0x1FE6),
+    (0x3C9, 0x300, 0x1F7C),
+    (0x3C9, 0x301, 0x3CE),
+    (0x3C9, 0x313, 0x1F60),
+    (0x3C9, 0x314, 0x1F61),
+    (0x3C9, 0x342, 0x1FF6),
+    (0x3C9, 0x345, 0x1FF3),
+    (0x3CA, 0x300, 0x1FD2),
+    (0x3CA, 0x301, 0x390),
+    (0x3CA, 0x342, 0x1FD7),
+    (0x3CB, 0x300, 0x1FE2),
+    (0x3CB, 0x301, 0x3B0),
+    (0x3CB, 0x342, 0x1FE7),
+    (0x3CE, 0x345, 0x1FF4),
+    (0x3D2, 0x301, 0x3D3),
+    (0x3D2, 0x308, 0x3D4),
+    (0x406, 0x308, 0x407),
+    (0x410, 0x306, 0x4D0),
+    (0x410, 0x308, 0x4D2),
+    (0x413, 0x301, 0x403),
+    (0x415, 0x300, 0x400),
+    (0x415, 0x306, 0x4D6),
+    (0x415, 0x308, 0x401),
+    (0x416, 0x306, 0x4C1),
+    (0x416, 0x308, 0x4DC),
+    (0x417, 0x308, 0x4DE),
+    (0x418, 0x300, 0x40D),
+    (0x418, 0x304, 0x4E2),
+    (0x418, 0x306, 0x419),
+    (0x418, 0x308, 0x4E4),
+    (0x41A, 0x301, 0x40C),
+    (0x41E, 0x308, 0x4E6),
+    (0x423, 0x304, 0x4EE),
+    (0x423, 0x306, 0x40E),
+    (0x423, 0x308, 0x4F0),
+    (0x423, 0x30B, 0x4F2),
+    (0x427, 0x308, 0x4F4),
+    (0x42B, 0x308, 0x4F8),
+    (0x42D, 0x308, 0x4EC),
+    (0x430, 0x306, 0x4D1),
+    (0x430, 0x308, 0x4D3),
+    (0x433, 0x301, 0x453),
+    (0x435, 0x300, 0x450),
+    (0x435, 0x306, 0x4D7),
+    (0x435, 0x308, 0x451),
+    (0x436, 0x306, 0x4C2),
+    (0x436, 0x308, 0x4DD),
+    (0x437, 0x308, 0x4DF),
+    (0x438, 0x300, 0x45D),
+    (0x438, 0x304, 0x4E3),
+    (0x438, 0x306, 0x439),
+    (0x438, 0x308, 0x4E5),
+    (0x43A, 0x301, 0x45C),
+    (0x43E, 0x308, 0x4E7),
+    (0x443, 0x304, 0x4EF),
+    (0x443, 0x306, 0x45E),
+    (0x443, 0x308, 0x4F1),
+    (0x443, 0x30B, 0x4F3),
+    (0x447, 0x308, 0x4F5),
+    (0x44B, 0x308, 0x4F9),
+    (0x44D, 0x308, 0x4ED),
+    (0x456, 0x308, 0x457),
+    (0x474, 0x30F, 0x476),
+    (0x475, 0x30F, 0x477),
+    (0x4D8, 0x308, 0x4DA),
+    (0x4D9, 0x308, 0x4DB),
+    (0x4E8, 0x308, 0x4EA),
+    (0x4E9, 0x308, 0x4EB),
+    (0x627, 0x653, 0x622),
+    (0x627, 0x654, 0x623),
+    (0x627, 0x655, 0x625),
+    (0x648, 0x654, 0x624),
+    (0x64A, 0x654, 0x626),
+    (0x6C1, 0x654, 0x6C2),
+    (0x6D2, 0x654, 0x6D3),
+    (0x6D5, 0x654, 0x6C0),
+    (0x928, 0x93C, 0x929),
+    (0x930, 0x93C, 0x931),
+    (0x933, 0x93C, 0x934),
+    (0x9C7, 0x9BE, 0x9CB),
+    (0x9C7, 0x9D7, 0x9CC),
+    (0xB47, 0xB3E, 0xB4B),
+    (0xB47, 0xB56, 0xB48),
+    (0xB47, 0xB57, 0xB4C),
+    (0xB92, 0xBD7, 0xB94),
+    (0xBC6, 0xBBE, 0xBCA),
+    (0xBC6, 0xBD7, 0xBCC),
+    (0xBC7, 0xBBE, 0xBCB),
+    (0xC46, 0xC56, 0xC48),
+    (0xCBF, 0xCD5, 0xCC0),
+    (0xCC6, 0xCC2, 0xCCA),
+    (0xCC6, 0xCD5, 0xCC7),
+    (0xCC6, 0xCD6, 0xCC8),
+    (0xCCA, 0xCD5, 0xCCB),
+    (0xD46, 0xD3E, 0xD4A),
+    (0xD46, 0xD57, 0xD4C),
+    (0xD47, 0xD3E, 0xD4B),
+    (0xDD9, 0xDCA, 0xDDA),
+    (0xDD9, 0xDCF, 0xDDC),
+    (0xDD9, 0xDDF, 0xDDE),
+    (0xDDC, 0xDCA, 0xDDD),
+    (0x1025, 0x102E, 0x1026),
+    (0x1B05, 0x1B35, 0x1B06),
+    (0x1B07, 0x1B35, 0x1B08),
+    (0x1B09, 0x1B35, 0x1B0A),
+    (0x1B0B, 0x1B35, 0x1B0C),
+    (0x1B0D, 0x1B35, 0x1B0E),
+    (0x1B11, 0x1B35, 0x1B12),
+    (0x1B3A, 0x1B35, 0x1B3B),
+    (0x1B3C, 0x1B35, 0x1B3D),
+    (0x1B3E, 0x1B35, 0x1B40),
+    (0x1B3F, 0x1B35, 0x1B41),
+    (0x1B42, 0x1B35, 0x1B43),
+    (0x1E36, 0x304, 0x1E38),
+    (0x1E37, 0x304, 0x1E39),
+    (0x1E5A, 0x304, 0x1E5C),
+    (0x1E5B, 0x304, 0x1E5D),
+    (0x1E62, 0x307, 0x1E68),
+    (0x1E63, 0x307, 0x1E69),
+    (0x1EA0, 0x302, 0x1EAC),
+    (0x1EA0, 0x306, 0x1EB6),
+    (0x1EA1, 0x302, 0x1EAD),
+    (0x1EA1, 0x306, 0x1EB7),
+    (0x1EB8, 0x302, 0x1EC6),
+    (0x1EB9, 0x302, 0x1EC7),
+    (0x1ECC, 0x302, 0x1ED8),
+    (0x1ECD, 0x302, 0x1ED9),
+    (0x1F00, 0x300, 0x1F02),
+    (0x1F00, 0x301, 0x1F04),
+    (0x1F00, 0x342, 0x1F06),
+    (0x1F00, 0x345, 0x1F80),
+    (0x1F01, 0x300, 0x1F03),
+    (0x1F01, 0x301, 0x1F05),
+    (0x1F01, 0x342, 0x1F07),
+    (0x1F01, 0x345, 0x1F81),
+    (0x1F02, 0x345, 0x1F82),
+    (0x1F03, 0x345, 0x1F83),
+    (0x1F04, 0x345, 0x1F84),
+    (0x1F05, 0x345, 0x1F85),
+    (0x1F06, 0x345, 0x1F86),
+    (0x1F07, 0x345, 0x1F87),
+    (0x1F08, 0x300, 0x1F0A),
+    (0x1F08, 0x301, 0x1F0C),
+    (0x1F08, 0x342, 0x1F0E),
+    (0x1F08, 0x345, 0x1F88),
+    (0x1F09, 0x300, 0x1F0B),
+    (0x1F09, 0x301, 0x1F0D),
+    (0x1F09, 0x342, 0x1F0F),
+    (0x1F09, 0x345, 0x1F89),
+    (0x1F0A, 0x345, 0x1F8A),
+    (0x1F0B, 0x345, 0x1F8B),
+    (0x1F0C, 0x345, 0x1F8C),
+    (0x1F0D, 0x345, 0x1F8D),
+    (0x1F0E, 0x345, 0x1F8E),
+    (0x1F0F, 0x345, 0x1F8F),
+    (0x1F10, 0x300, 0x1F12),
+    (0x1F10, 0x301, 0x1F14),
+    (0x1F11, 0x300, 0x1F13),
+    (0x1F11, 0x301, 0x1F15),
+    (0x1F18, 0x300, 0x1F1A),
+    (0x1F18, 0x301, 0x1F1C),
+    (0x1F19, 0x300, 0x1F1B),
+    (0x1F19, 0x301, 0x1F1D),
+    (0x1F20, 0x300, 0x1F22),
+    (0x1F20, 0x301, 0x1F24),
+    (0x1F20, 0x342, 0x1F26),
+    (0x1F20, 0x345, 0x1F90),
+    (0x1F21, 0x300, 0x1F23),
+    (0x1F21, 0x301, 0x1F25),
+    (0x1F21, 0x342, 0x1F27),
+    (0x1F21, 0x345, 0x1F91),
+    (0x1F22, 0x345, 0x1F92),
+    (0x1F23, 0x345, 0x1F93),
+    (0x1F24, 0x345, 0x1F94),
+    (0x1F25, 0x345, 0x1F95),
+    (0x1F26, 0x345, 0x1F96),
+    (0x1F27, 0x345, 0x1F97),
+    (0x1F28, 0x300, 0x1F2A),
+    (0x1F28, 0x301, 0x1F2C),
+    (0x1F28, 0x342, 0x1F2E),
+    (0x1F28, 0x345, 0x1F98),
+    (0x1F29, 0x300, 0x1F2B),
+    (0x1F29, 0x301, 0x1F2D),
+    (0x1F29, 0x342, 0x1F2F),
+    (0x1F29, 0x345, 0x1F99),
+    (0x1F2A, 0x345, 0x1F9A),
+    (0x1F2B, 0x345, 0x1F9B),
+    (0x1F2C, 0x345, 0x1F9C),
+    (0x1F2D, 0x345, 0x1F9D),
+    (0x1F2E, 0x345, 0x1F9E),
+    (0x1F2F, 0x345, 0x1F9F),
+    (0x1F30, 0x300, 0x1F32),
+    (0x1F30, 0x301, 0x1F34),
+    (0x1F30, 0x342, 0x1F36),
+    (0x1F31, 0x300, 0x1F33),
+    (0x1F31, 0x301, 0x1F35),
+    (0x1F31, 0x342, 0x1F37),
+    (0x1F38, 0x300, 0x1F3A),
+    (0x1F38, 0x301, 0x1F3C),
+    (0x1F38, 0x342, 0x1F3E),
+    (0x1F39, 0x300, 0x1F3B),
+    (0x1F39, 0x301, 0x1F3D),
+    (0x1F39, 0x342, 0x1F3F),
+    (0x1F40, 0x300, 0x1F42),
+    (0x1F40, 0x301, 0x1F44),
+    (0x1F41, 0x300, 0x1F43),
+    (0x1F41, 0x301, 0x1F45),
+    (0x1F48, 0x300, 0x1F4A),
+    (0x1F48, 0x301, 0x1F4C),
+    (0x1F49, 0x300, 0x1F4B),
+    (0x1F49, 0x301, 0x1F4D),
+    (0x1F50, 0x300, 0x1F52),
+    (0x1F50, 0x301, 0x1F54),
+    (0x1F50, 0x342, 0x1F56),
+    (0x1F51, 0x300, 0x1F53),
+    (0x1F51, 0x301, 0x1F55),
+    (0x1F51, 0x342, 0x1F57),
+    (0x1F59, 0x300, 0x1F5B),
+    (0x1F59, 0x301, 0x1F5D),
+    (0x1F59, 0x342, 0x1F5F),
+    (0x1F60, 0x300, 0x1F62),
+    (0x1F60, 0x301, 0x1F64),
+    (0x1F60, 0x342, 0x1F66),
+    (0x1F60, 0x345, 0x1FA0),
+    (0x1F61, 0x300, 0x1F63),
+    (0x1F61, 0x301, 0x1F65),
+    (0x1F61, 0x342, 0x1F67),
+    (0x1F61, 0x345, 0x1FA1),
+    (0x1F62, 0x345, 0x1FA2),
+    (0x1F63, 0x345, 0x1FA3),
+    (0x1F64, 0x345, 0x1FA4),
+    (0x1F65, 0x345, 0x1FA5),
+    (0x1F66, 0x345, 0x1FA6),
+    (0x1F67, 0x345, 0x1FA7),
+    (0x1F68, 0x300, 0x1F6A),
+    (0x1F68, 0x301, 0x1F6C),
+    (0x1F68, 0x342, 0x1F6E),
+    (0x1F68, 0x345, 0x1FA8),
+    (0x1F69, 0x300, 0x1F6B),
+    (0x1F69, 0x301, 0x1F6D),
+    (0x1F69, 0x342, 0x1F6F),
+    (0x1F69, 0x345, 0x1FA9),
+    (0x1F6A, 0x345, 0x1FAA),
+    (0x1F6B, 0x345, 0x1FAB),
+    (0x1F6C, 0x345, 0x1FAC),
+    (0x1F6D, 0x345, 0x1FAD),
+    (0x1F6E, 0x345, 0x1FAE),
+    (0x1F6F, 0x345, 0x1FAF),
+    (0x1F70, 0x345, 0x1FB2),
+    (0x1F74, 0x345, 0x1FC2),
+    (0x1F7C, 0x345, 0x1FF2),
+    (0x1FB6, 0x345, 0x1FB7),
+    (0x1FBF, 0x300, 0x1FCD),
+    (0x1FBF, 0x301, 0x1FCE),
+    (0x1FBF, 0x342, 0x1FCF),
+    (0x1FC6, 0x345, 0x1FC7),
+    (0x1FF6, 0x345, 0x1FF7),
+    (0x1FFE, 0x300, 0x1FDD),
+    (0x1FFE, 0x301, 0x1FDE),
+    (0x1FFE, 0x342, 0x1FDF),
+    (0x2190, 0x338, 0x219A),
+    (0x2192, 0x338, 0x219B),
+    (0x2194, 0x338, 0x21AE),
+    (0x21D0, 0x338, 0x21CD),
+    (0x21D2, 0x338, 0x21CF),
+    (0x21D4, 0x338, 0x21CE),
+    (0x2203, 0x338, 0x2204),
+    (0x2208, 0x338, 0x2209),
+    (0x220B, 0x338, 0x220C),
+    (0x2223, 0x338, 0x2224),
+    (0x2225, 0x338, 0x2226),
+    (0x223C, 0x338, 0x2241),
+    (0x2243, 0x338, 0x2244),
+    (0x2245, 0x338, 0x2247),
+    (0x2248, 0x338, 0x2249),
+    (0x224D, 0x338, 0x226D),
+    (0x2261, 0x338, 0x2262),
+    (0x2264, 0x338, 0x2270),
+    (0x2265, 0x338, 0x2271),
+    (0x2272, 0x338, 0x2274),
+    (0x2273, 0x338, 0x2275),
+    (0x2276, 0x338, 0x2278),
+    (0x2277, 0x338, 0x2279),
+    (0x227A, 0x338, 0x2280),
+    (0x227B, 0x338, 0x2281),
+    (0x227C, 0x338, 0x22E0),
+    (0x227D, 0x338, 0x22E1),
+    (0x2282, 0x338, 0x2284),
+    (0x2283, 0x338, 0x2285),
+    (0x2286, 0x338, 0x2288),
+    (0x2287, 0x338, 0x2289),
+    (0x2291, 0x338, 0x22E2),
+    (0x2292, 0x338, 0x22E3),
+    (0x22A2, 0x338, 0x22AC),
+    (0x22A8, 0x338, 0x22AD),
+    (0x22A9, 0x338, 0x22AE),
+    (0x22AB, 0x338, 0x22AF),
+    (0x22B2, 0x338, 0x22EA),
+    (0x22B3, 0x338, 0x22EB),
+    (0x22B4, 0x338, 0x22EC),
+    (0x22B5, 0x338, 0x22ED),
+    (0x3046, 0x3099, 0x3094),
+    (0x304B, 0x3099, 0x304C),
+    (0x304D, 0x3099, 0x304E),
+    (0x304F, 0x3099, 0x3050),
+    (0x3051, 0x3099, 0x3052),
+    (0x3053, 0x3099, 0x3054),
+    (0x3055, 0x3099, 0x3056),
+    (0x3057, 0x3099, 0x3058),
+    (0x3059, 0x3099, 0x305A),
+    (0x305B, 0x3099, 0x305C),
+    (0x305D, 0x3099, 0x305E),
+    (0x305F, 0x3099, 0x3060),
+    (0x3061, 0x3099, 0x3062),
+    (0x3064, 0x3099, 0x3065),
+    (0x3066, 0x3099, 0x3067),
+    (0x3068, 0x3099, 0x3069),
+    (0x306F, 0x3099, 0x3070),
+    (0x306F, 0x309A, 0x3071),
+    (0x3072, 0x3099, 0x3073),
+    (0x3072, 0x309A, 0x3074),
+    (0x3075, 0x3099, 0x3076),
+    (0x3075, 0x309A, 0x3077),
+    (0x3078, 0x3099, 0x3079),
+    (0x3078, 0x309A, 0x307A),
+    (0x307B, 0x3099, 0x307C),
+    (0x307B, 0x309A, 0x307D),
+    (0x309D, 0x3099, 0x309E),
+    (0x30A6, 0x3099, 0x30F4),
+    (0x30AB, 0x3099, 0x30AC),
+    (0x30AD, 0x3099, 0x30AE),
+    (0x30AF, 0x3099, 0x30B0),
+    (0x30B1, 0x3099, 0x30B2),
+    (0x30B3, 0x3099, 0x30B4),
+    (0x30B5, 0x3099, 0x30B6),
+    (0x30B7, 0x3099, 0x30B8),
+    (0x30B9, 0x3099, 0x30BA),
+    (0x30BB, 0x3099, 0x30BC),
+    (0x30BD, 0x3099, 0x30BE),
+    (0x30BF, 0x3099, 0x30C0),
+    (0x30C1, 0x3099, 0x30C2),
+    (0x30C4, 0x3099, 0x30C5),
+    (0x30C6, 0x3099, 0x30C7),
+    (0x30C8, 0x3099, 0x30C9),
+    (0x30CF, 0x3099, 0x30D0),
+    (0x30CF, 0x309A, 0x30D1),
+    (0x30D2, 0x3099, 0x30D3),
+    (0x30D2, 0x309A, 0x30D4),
+    (0x30D5, 0x3099, 0x30D6),
+    (0x30D5, 0x309A, 0x30D7),
+    (0x30D8, 0x3099, 0x30D9),
+    (0x30D8, 0x309A, 0x30DA),
+    (0x30DB, 0x3099, 0x30DC),
+    (0x30DB, 0x309A, 0x30DD),
+    (0x30EF, 0x3099, 0x30F7),
+    (0x30F0, 0x3099, 0x30F8),
+    (0x30F1, 0x3099, 0x30F9),
+    (0x30F2, 0x3099, 0x30FA),
+    (0x30FD, 0x3099, 0x30FE),
+    (0x11099, 0x110BA, 0x1109A),
+    (0x1109B, 0x110BA, 0x1109C),
+    (0x110A5, 0x110BA, 0x110AB),
+    (0x11131, 0x11127, 0x1112E),
+    (0x11132, 0x11127, 0x1112F),
+    (0x11347, 0x1133E, 0x1134B),
+    (0x11347, 0x11357, 0x1134C),
+    (0x114B9, 0x114B0, 0x114BC),
+    (0x114B9, 0x114BA, 0x114BB),
+    (0x114B9, 0x114BD, 0x114BE),
+    (0x115B8, 0x115AF, 0x115BA),
+    (0x115B9, 0x115AF, 0x115BB),
+    (0x11935, 0x11930, 0x11938),
+];
@@ -0,0 +1,277 @@
+/*
+
+Buffer windows
+==============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::io;
+
+use super::super::arena::UpdateArena;
+use super::super::metrics::record;
+use super::super::protocol::*;
+use super::super::snapshot::*;
+use super::scrollback::Scrollback;
+
+/** Output written to a buffer window since the last update
+ *
+ * All text goes into one string, and runs are ranges of it. Consecutive writes with the same style and hyperlink extend the last run, so writing text only appends to the string. `TextRun`s are only made when the update is built.
+ *
+ * Once sent, paragraphs move to the window's scrollback.
+ */
+pub struct BufferWindowText {
+    clear: bool,
+    hyperlink: Option<u32>,
+    paragraphs: Vec<PendingParagraph>,
+    runs: Vec<PendingRun>,
+    scrollback: Scrollback,
+    style: Style,
+    text: String,
+}
+
+struct PendingParagraph {
+    /** Index of this paragraph's first run */
+    first_run: usize,
+    flowbreak: bool,
+}
+
+struct PendingRun {
+    /** Byte offset of the end of this run; it starts at the previous run's end */
+    end: usize,
+    hyperlink: Option<u32>,
+    style: Style,
+}
+
+impl Default for BufferWindowText {
+    fn default() -> Self {
+        BufferWindowText {
+            clear: false,
+            hyperlink: None,
+            paragraphs: Vec::new(),
+            runs: Vec::new(),
+            scrollback: Scrollback::new(),
+            style: Style::Normal,
+            text: String::new(),
+        }
+    }
+}
+
+impl BufferWindowText {
+    pub fn new() -> Self {
+        BufferWindowText::default()
+    }
+
+    /** Clear the window, discarding any pending text and the scrollback */
+    pub fn clear(&mut self) {
+        self.clear = true;
+        self.paragraphs.clear();
+        self.runs.clear();
+        self.scrollback.clear();
+        self.text.clear();
+    }
+
+    /** Mark a paragraph break after any floating images */
+    pub fn flowbreak(&mut self) {
+        self.current_paragraph();
+        self.paragraphs.last_mut().unwrap().flowbreak = true;
+    }
+
+    pub fn is_empty(&self) -> bool {
+        !self.clear && self.paragraphs.is_empty()
+    }
+
+    #[inline]
+    pub fn put_char(&mut self, ch: u32) {
+        record!(put_char_calls += 1);
+        if ch == 10 {
+            self.new_paragraph();
+        }
+        else {
+            let ch = char::from_u32(ch).unwrap_or(char::REPLACEMENT_CHARACTER);
+            self.current_run();
+            self.text.push(ch);
+            self.runs.last_mut().unwrap().end = self.text.len();
+        }
+    }
+
+    /** Restore text saved by `snapshot` */
+    pub fn from_snapshot(r: &mut SectionReader) -> io::Result<Self> {
+        let invalid = || io::Error::new(io::ErrorKind::InvalidData, "Invalid buffer window snapshot");
+        let mut buffer = BufferWindowText {
+            clear: r.bool()?,
+            hyperlink: r.opt_u32()?,
+            style: read_name(r, Style::from_name)?,
+            text: r.str()?.to_owned(),
+            ..Default::default()
+        };
+        let run_count = r.usize()?;
+        let mut start = 0;
+        for _ in 0..run_count {
+            let end = r.usize()?;
+            // Runs must cover the text in order, or take_update would panic
+            if end < start || !buffer.text.is_char_boundary(end) {
+                return Err(invalid());
+            }
+            start = end;
+            buffer.runs.push(PendingRun {
+                end,
+                hyperlink: r.opt_u32()?,
+                style: read_name(r, Style::from_name)?,
+            });
+        }
+        let paragraph_count = r.usize()?;
+        let mut first_run = 0;
+        for _ in 0..paragraph_count {
+            let next = r.usize()?;
+            if next < first_run || next > buffer.runs.len() {
+                return Err(invalid());
+            }
+            first_run = next;
+            buffer.paragraphs.push(PendingParagraph {
+                first_run,
+                flowbreak: r.bool()?,
+            });
+        }
+        if start != buffer.text.len() || (!buffer.runs.is_empty() && buffer.paragraphs.is_empty()) {
+            return Err(invalid());
+        }
+        Ok(buffer)
+    }
+
+    pub fn put_str(&mut self, str: &str) {
+        record!(put_string_calls += 1);
+        record!(put_string_bytes += str.len() as u64);
+        for (i, line) in str.split('\n').enumerate() {
+            if i > 0 {
+                self.new_paragraph();
+            }
+            if !line.is_empty() {
+                self.current_run();
+                self.text.push_str(line);
+                self.runs.last_mut().unwrap().end = self.text.len();
+            }
+        }
+    }
+
+    pub fn scrollback(&self) -> &Scrollback {
+        &self.scrollback
+    }
+
+    pub fn scrollback_mut(&mut self) -> &mut Scrollback {
+        &mut self.scrollback
+    }
+
+    pub fn set_hyperlink(&mut self, hyperlink: Option<u32>) {
+        self.hyperlink = hyperlink;
+    }
+
+    pub fn set_style(&mut self, style: Style) {
+        self.style = style;
+    }
+
+    pub fn snapshot(&self, w: &mut SectionWriter) {
+        w.bool(self.clear);
+        w.opt_u32(self.hyperlink);
+        w.str(self.style.name());
+        w.str(&self.text);
+        w.usize(self.runs.len());
+        for run in &self.runs {
+            w.usize(run.end);
+            w.opt_u32(run.hyperlink);
+            w.str(run.style.name());
+        }
+        w.usize(self.paragraphs.len());
+        for paragraph in &self.paragraphs {
+            w.usize(paragraph.first_run);
+            w.bool(paragraph.flowbreak);
+        }
+    }
+
+    /** Build the content update for this window, if there's anything to send, and reset for the next turn */
+    pub fn take_update(&mut self, id: u32, arena: &mut UpdateArena) -> Option<BufferWindowContentUpdate> {
+        if self.is_empty() {
+            return None;
+        }
+        let mut text = arena.paragraphs();
+        text.reserve(self.paragraphs.len());
+        let mut start = 0;
+        for (i, paragraph) in self.paragraphs.iter().enumerate() {
+            let end_run = self.paragraphs.get(i + 1).map_or(self.runs.len(), |next| next.first_run);
+            let runs = &self.runs[paragraph.first_run..end_run];
+            let paragraph_start = start;
+            let paragraph_end = runs.last().map_or(start, |run| run.end);
+            self.scrollback.push_paragraph(i == 0, paragraph.flowbreak, &self.text[paragraph_start..paragraph_end], runs.iter().map(|run| (run.end - paragraph_start, run.hyperlink, run.style)));
+            let mut content = arena.lines();
+            content.extend(runs.iter().map(|run| {
+                let run_text = arena.string_from(&self.text[start..run.end]);
+                start = run.end;
+                LineData::TextRun(TextRun {
+                    css_styles: None,
+                    hyperlink: run.hyperlink,
+                    style: run.style,
+                    text: run_text,
+                })
+            }));
+            text.push(BufferWindowParagraphUpdate {
+                // The first paragraph continues the last line of the previous update
+                append: if i == 0 {Some(true)} else {None},
+                content: Some(content),
+                flowbreak: if paragraph.flowbreak {Some(true)} else {None},
+            });
+        }
+        let update = BufferWindowContentUpdate {
+            base: TextualWindowUpdate {
+                id,
+                clear: if self.clear {Some(true)} else {None},
+                bg: None,
+                fg: None,
+            },
+            text: Some(text),
+        };
+        self.clear = false;
+        self.paragraphs.clear();
+        self.runs.clear();
+        self.text.clear();
+        Some(update)
+    }
+
+    fn current_paragraph(&mut self) {
+        if self.paragraphs.is_empty() {
+            self.push_paragraph();
+        }
+    }
+
+    /** Make sure the last run matches the current style and hyperlink */
+    #[inline]
+    fn current_run(&mut self) {
+        self.current_paragraph();
+        let first_run = self.paragraphs.last().unwrap().first_run;
+        if let Some(run) = self.runs.last() {
+            if self.runs.len() > first_run && run.style == self.style && run.hyperlink == self.hyperlink {
+                return;
+            }
+        }
+        self.runs.push(PendingRun {
+            end: self.text.len(),
+            hyperlink: self.hyperlink,
+            style: self.style,
+        });
+    }
+
+    /** End the current line and start a new paragraph */
+    fn new_paragraph(&mut self) {
+        self.current_paragraph();
+        self.push_paragraph();
+    }
+
+    fn push_paragraph(&mut self) {
+        self.paragraphs.push(PendingParagraph {
+            first_run: self.runs.len(),
+            flowbreak: false,
+        });
+    }
+}
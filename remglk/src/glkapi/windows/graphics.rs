@@ -0,0 +1,176 @@
+/*
+
+Graphics windows
+================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use super::super::protocol::*;
+
+/** A rectangle which an operation draws over. Fills without a rectangle cover the whole window */
+#[derive(Clone, Copy, PartialEq)]
+struct Area {
+    bottom: u64,
+    left: u64,
+    right: u64,
+    top: u64,
+}
+
+const WHOLE_WINDOW: Area = Area {
+    bottom: u64::MAX,
+    left: 0,
+    right: u64::MAX,
+    top: 0,
+};
+
+impl Area {
+    fn new(x: u32, y: u32, width: u32, height: u32) -> Self {
+        Area {
+            bottom: y as u64 + height as u64,
+            left: x as u64,
+            right: x as u64 + width as u64,
+            top: y as u64,
+        }
+    }
+
+    fn contains(&self, other: &Area) -> bool {
+        self.left <= other.left && self.top <= other.top && self.right >= other.right && self.bottom >= other.bottom
+    }
+
+    /** The two areas' union, if it is a rectangle */
+    fn union(&self, other: &Area) -> Option<Area> {
+        let side_by_side = self.top == other.top && self.bottom == other.bottom && self.left <= other.right && other.left <= self.right;
+        let stacked = self.left == other.left && self.right == other.right && self.top <= other.bottom && other.top <= self.bottom;
+        if side_by_side || stacked {
+            Some(Area {
+                bottom: self.bottom.max(other.bottom),
+                left: self.left.min(other.left),
+                right: self.right.max(other.right),
+                top: self.top.min(other.top),
+            })
+        }
+        else {
+            None
+        }
+    }
+}
+
+fn fill_area(op: &FillOperation) -> Area {
+    match (op.x, op.y, op.width, op.height) {
+        (Some(x), Some(y), Some(width), Some(height)) => Area::new(x, y, width, height),
+        _ => WHOLE_WINDOW,
+    }
+}
+
+fn op_area(op: &GraphicsWindowOperation) -> Option<Area> {
+    match op {
+        GraphicsWindowOperation::FillOperation(op) => Some(fill_area(op)),
+        GraphicsWindowOperation::ImageOperation(op) => Some(Area::new(op.x, op.y, op.width, op.height)),
+        GraphicsWindowOperation::SetcolorOperation(_) => None,
+    }
+}
+
+/** Whether a fill colour hides what is beneath it. We only make `#rrggbb` colours; fills without a colour use the window's background colour, which is one too */
+fn is_opaque(color: &Option<String>) -> bool {
+    match color {
+        Some(color) => color.len() == 7 && color.starts_with('#'),
+        None => true,
+    }
+}
+
+/** A graphics window's operations waiting to be sent
+ *
+ * Operations are simplified as they are queued: anything completely covered by a later opaque fill is dropped, a fill which adjoins the one before it in the same colour is merged into it, and background colour changes which don't change the colour or are overridden before any fill uses them are dropped.
+ */
+#[derive(Default)]
+pub struct GraphicsWindow {
+    /** The background colour once the queued operations have been drawn */
+    color: Option<String>,
+    ops: Vec<GraphicsWindowOperation>,
+}
+
+impl GraphicsWindow {
+    pub fn new() -> Self {
+        GraphicsWindow::default()
+    }
+
+    pub fn draw_image(&mut self, op: ImageOperation) {
+        self.ops.push(GraphicsWindowOperation::ImageOperation(op));
+    }
+
+    pub fn fill(&mut self, op: FillOperation) {
+        let area = fill_area(&op);
+        if is_opaque(&op.color) {
+            // Drop whatever this fill hides
+            let before = self.ops.len();
+            self.ops.retain(|queued| !op_area(queued).is_some_and(|queued| area.contains(&queued)));
+            if self.ops.len() != before {
+                self.collapse_setcolors();
+            }
+        }
+        // Overlapping translucent fills can't be merged, as the overlap is drawn twice
+        if let Some(GraphicsWindowOperation::FillOperation(last)) = self.ops.last_mut() {
+            if last.color == op.color && is_opaque(&op.color) {
+                let last_area = fill_area(last);
+                if last_area.contains(&area) {
+                    return;
+                }
+                if let Some(union) = last_area.union(&area) {
+                    last.x = Some(union.left as u32);
+                    last.y = Some(union.top as u32);
+                    last.width = Some((union.right - union.left) as u32);
+                    last.height = Some((union.bottom - union.top) as u32);
+                    return;
+                }
+            }
+        }
+        self.ops.push(GraphicsWindowOperation::FillOperation(op));
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.ops.is_empty()
+    }
+
+    /** How many operations are queued */
+    pub fn len(&self) -> usize {
+        self.ops.len()
+    }
+
+    /** Set the background colour, used by fills without a colour */
+    pub fn set_color(&mut self, color: String) {
+        if self.color.as_ref() == Some(&color) {
+            return;
+        }
+        self.color = Some(color.clone());
+        if let Some(GraphicsWindowOperation::SetcolorOperation(last)) = self.ops.last_mut() {
+            last.color = color;
+            return;
+        }
+        self.ops.push(GraphicsWindowOperation::SetcolorOperation(SetcolorOperation {color}));
+    }
+
+    pub fn take_update(&mut self, id: u32) -> Option<GraphicsWindowContentUpdate> {
+        if self.ops.is_empty() {
+            return None;
+        }
+        Some(GraphicsWindowContentUpdate {
+            id,
+            draw: std::mem::take(&mut self.ops),
+        })
+    }
+
+    /** After operations are dropped setcolors may have become adjacent, in which case only the last matters */
+    fn collapse_setcolors(&mut self) {
+        self.ops.dedup_by(|later, earlier| match (later, earlier) {
+            (GraphicsWindowOperation::SetcolorOperation(later), GraphicsWindowOperation::SetcolorOperation(earlier)) => {
+                std::mem::swap(&mut later.color, &mut earlier.color);
+                true
+            },
+            _ => false,
+        });
+    }
+}
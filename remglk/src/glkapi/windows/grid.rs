@@ -0,0 +1,279 @@
+/*
+
+Grid windows
+============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::io;
+
+use super::super::arena::UpdateArena;
+use super::super::metrics::record;
+use super::super::protocol::*;
+use super::super::snapshot::*;
+
+/** A grid cell: the character in bits 0-20, the style in bits 21-24, and the hyperlink in the high 32 bits */
+#[derive(Clone, Copy, PartialEq)]
+struct Cell(u64);
+
+const BLANK: Cell = Cell(' ' as u64);
+
+impl Cell {
+    fn new(ch: char, style: Style, hyperlink: Option<u32>) -> Self {
+        Cell(ch as u64 | (style as u64) << 21 | (hyperlink.unwrap_or(0) as u64) << 32)
+    }
+
+    fn ch(self) -> char {
+        char::from_u32(self.0 as u32 & 0x1FFFFF).unwrap_or(char::REPLACEMENT_CHARACTER)
+    }
+
+    fn hyperlink(self) -> Option<u32> {
+        match (self.0 >> 32) as u32 {
+            0 => None,
+            val => Some(val),
+        }
+    }
+
+    fn style(self) -> Style {
+        Style::from_glk((self.0 >> 21) as u32 & 0xF).unwrap_or(Style::Normal)
+    }
+
+    /** Whether two cells can share a text run */
+    fn same_run(self, other: Cell) -> bool {
+        self.0 >> 21 == other.0 >> 21
+    }
+}
+
+/** A grid window's contents
+ *
+ * Cells are stored contiguously, row by row. A bitset tracks which lines have been written to, and a copy of the last frame sent is kept so that only lines which actually changed are sent, even when a game redraws the whole grid every turn.
+ */
+pub struct GridWindow {
+    cells: Vec<Cell>,
+    dirty: Vec<u64>,
+    height: usize,
+    hyperlink: Option<u32>,
+    sent: Vec<Cell>,
+    style: Style,
+    width: usize,
+    x: usize,
+    y: usize,
+}
+
+impl GridWindow {
+    pub fn new(width: usize, height: usize) -> Self {
+        let mut grid = GridWindow {
+            cells: Vec::new(),
+            dirty: Vec::new(),
+            height: 0,
+            hyperlink: None,
+            sent: Vec::new(),
+            style: Style::Normal,
+            width: 0,
+            x: 0,
+            y: 0,
+        };
+        grid.resize(width, height);
+        grid
+    }
+
+    /** Blank the whole grid and move the cursor home */
+    pub fn clear(&mut self) {
+        self.cells.fill(BLANK);
+        self.mark_all_dirty();
+        self.x = 0;
+        self.y = 0;
+    }
+
+    pub fn cursor(&self) -> (usize, usize) {
+        (self.x, self.y)
+    }
+
+    pub fn height(&self) -> usize {
+        self.height
+    }
+
+    /** Send every line in the next update, whether or not it changed (ie, after a refresh) */
+    pub fn invalidate(&mut self) {
+        self.sent.fill(Cell(u64::MAX));
+        self.mark_all_dirty();
+    }
+
+    pub fn move_cursor(&mut self, x: usize, y: usize) {
+        self.x = x;
+        self.y = y;
+    }
+
+    #[inline]
+    pub fn put_char(&mut self, ch: u32) {
+        record!(put_char_calls += 1);
+        self.write_char(ch);
+    }
+
+    pub fn put_str(&mut self, str: &str) {
+        record!(put_string_calls += 1);
+        record!(put_string_bytes += str.len() as u64);
+        for ch in str.chars() {
+            self.write_char(ch as u32);
+        }
+    }
+
+    #[inline]
+    fn write_char(&mut self, ch: u32) {
+        // A grid with no columns has no cells to write to
+        if self.width == 0 {
+            return;
+        }
+        if ch == 10 {
+            self.x = 0;
+            self.y += 1;
+            return;
+        }
+        if self.x >= self.width {
+            self.x = 0;
+            self.y += 1;
+        }
+        if self.y >= self.height {
+            return;
+        }
+        let cell = Cell::new(char::from_u32(ch).unwrap_or(char::REPLACEMENT_CHARACTER), self.style, self.hyperlink);
+        let index = self.y * self.width + self.x;
+        if self.cells[index] != cell {
+            self.cells[index] = cell;
+            self.dirty[self.y / 64] |= 1 << (self.y % 64);
+        }
+        self.x += 1;
+    }
+
+    /** Resize the grid, keeping what fits */
+    pub fn resize(&mut self, width: usize, height: usize) {
+        let mut cells = vec![BLANK; width * height];
+        for y in 0..height.min(self.height) {
+            let keep = width.min(self.width);
+            cells[y * width..y * width + keep].copy_from_slice(&self.cells[y * self.width..y * self.width + keep]);
+        }
+        self.cells = cells;
+        self.dirty = vec![0; height.div_ceil(64)];
+        self.height = height;
+        self.sent = vec![Cell(u64::MAX); width * height];
+        self.width = width;
+        self.mark_all_dirty();
+    }
+
+    pub fn set_hyperlink(&mut self, hyperlink: Option<u32>) {
+        self.hyperlink = hyperlink;
+    }
+
+    pub fn set_style(&mut self, style: Style) {
+        self.style = style;
+    }
+
+    /** Build the content update for the lines which changed since the last update */
+    pub fn take_update(&mut self, id: u32, arena: &mut UpdateArena) -> Option<GridWindowContentUpdate> {
+        let mut lines = arena.grid_lines();
+        for (word_index, word) in self.dirty.iter_mut().enumerate() {
+            while *word != 0 {
+                let y = word_index * 64 + word.trailing_zeros() as usize;
+                *word &= *word - 1;
+                let row = y * self.width..(y + 1) * self.width;
+                if self.cells[row.clone()] == self.sent[row.clone()] {
+                    continue;
+                }
+                self.sent[row.clone()].copy_from_slice(&self.cells[row.clone()]);
+                lines.push(GridWindowLine {
+                    content: Some(line_runs(&self.cells[row], arena)),
+                    line: y as u32,
+                });
+            }
+        }
+        if lines.is_empty() {
+            arena.reclaim_grid_lines(lines);
+            return None;
+        }
+        Some(GridWindowContentUpdate {
+            base: TextualWindowUpdate {
+                id,
+                clear: None,
+                bg: None,
+                fg: None,
+            },
+            lines,
+        })
+    }
+
+    pub fn width(&self) -> usize {
+        self.width
+    }
+
+    /** Restore a grid saved by `snapshot`. The whole grid is sent in the next update */
+    pub fn from_snapshot(r: &mut SectionReader) -> io::Result<Self> {
+        let width = r.usize()?;
+        let height = r.usize()?;
+        let x = r.usize()?;
+        let y = r.usize()?;
+        let style = read_name(r, Style::from_name)?;
+        let hyperlink = r.opt_u32()?;
+        let cells = r.u64_slice()?;
+        // A grid with no columns has no cells to bound its height, but still needs a dirty bit for each line
+        if width.checked_mul(height) != Some(cells.len()) || (width == 0 && height > u16::MAX as usize) {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "Grid window snapshot has the wrong number of cells"));
+        }
+        let mut grid = GridWindow::new(width, height);
+        grid.hyperlink = hyperlink;
+        grid.style = style;
+        grid.x = x;
+        grid.y = y;
+        for (cell, &saved) in grid.cells.iter_mut().zip(cells.iter()) {
+            *cell = Cell(saved);
+        }
+        Ok(grid)
+    }
+
+    pub fn snapshot(&self, w: &mut SectionWriter) {
+        w.usize(self.width);
+        w.usize(self.height);
+        w.usize(self.x);
+        w.usize(self.y);
+        w.str(self.style.name());
+        w.opt_u32(self.hyperlink);
+        // Cell is a plain u64, so the cells can be written as they are
+        let cells: Vec<u64> = self.cells.iter().map(|cell| cell.0).collect();
+        w.u64_slice(&cells);
+    }
+
+    fn mark_all_dirty(&mut self) {
+        self.dirty.fill(u64::MAX);
+        // Don't leave bits set past the last line
+        if self.height % 64 != 0 {
+            if let Some(last) = self.dirty.last_mut() {
+                *last = (1 << (self.height % 64)) - 1;
+            }
+        }
+    }
+}
+
+/** Turn a row of cells into text runs */
+fn line_runs(row: &[Cell], arena: &mut UpdateArena) -> Vec<LineData> {
+    let mut runs = arena.lines();
+    let mut start = 0;
+    while start < row.len() {
+        let first = row[start];
+        let end = row[start..].iter().position(|&cell| !cell.same_run(first)).map_or(row.len(), |len| start + len);
+        runs.push(LineData::TextRun(TextRun {
+            css_styles: None,
+            hyperlink: first.hyperlink(),
+            style: first.style(),
+            text: {
+                let mut text = arena.string();
+                text.extend(row[start..end].iter().map(|cell| cell.ch()));
+                text
+            },
+        }));
+        start = end;
+    }
+    runs
+}
@@ -0,0 +1,441 @@
+/*
+
+Window layout
+=============
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+// The Glk constants are matched against
+#![allow(non_upper_case_globals)]
+
+use std::collections::HashMap;
+
+use super::super::constants::*;
+use super::super::protocol::*;
+
+impl From<&Metrics> for NormalisedMetrics {
+    /** Fold the fallbacks together: the most specific value given wins */
+    fn from(metrics: &Metrics) -> Self {
+        let pick = |values: &[Option<f64>], default: f64| values.iter().find_map(|&val| val).unwrap_or(default);
+        NormalisedMetrics {
+            buffercharheight: pick(&[metrics.buffercharheight, metrics.charheight], 1.0),
+            buffercharwidth: pick(&[metrics.buffercharwidth, metrics.charwidth], 1.0),
+            buffermarginx: pick(&[metrics.buffermarginx, metrics.buffermargin, metrics.marginx, metrics.margin], 0.0),
+            buffermarginy: pick(&[metrics.buffermarginy, metrics.buffermargin, metrics.marginy, metrics.margin], 0.0),
+            graphicsmarginx: pick(&[metrics.graphicsmarginx, metrics.graphicsmargin, metrics.marginx, metrics.margin], 0.0),
+            graphicsmarginy: pick(&[metrics.graphicsmarginy, metrics.graphicsmargin, metrics.marginy, metrics.margin], 0.0),
+            gridcharheight: pick(&[metrics.gridcharheight, metrics.charheight], 1.0),
+            gridcharwidth: pick(&[metrics.gridcharwidth, metrics.charwidth], 1.0),
+            gridmarginx: pick(&[metrics.gridmarginx, metrics.gridmargin, metrics.marginx, metrics.margin], 0.0),
+            gridmarginy: pick(&[metrics.gridmarginy, metrics.gridmargin, metrics.marginy, metrics.margin], 0.0),
+            height: metrics.height,
+            inspacingx: pick(&[metrics.inspacingx, metrics.inspacing, metrics.spacingx, metrics.spacing], 0.0),
+            inspacingy: pick(&[metrics.inspacingy, metrics.inspacing, metrics.spacingy, metrics.spacing], 0.0),
+            outspacingx: pick(&[metrics.outspacingx, metrics.outspacing, metrics.spacingx, metrics.spacing], 0.0),
+            outspacingy: pick(&[metrics.outspacingy, metrics.outspacing, metrics.spacingy, metrics.spacing], 0.0),
+            width: metrics.width,
+        }
+    }
+}
+
+/** A window's position and size, in pixels */
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct Rect {
+    pub height: f64,
+    pub left: f64,
+    pub top: f64,
+    pub width: f64,
+}
+
+/** The window tree, and the position of every window in it
+ *
+ * The metrics are normalised once when they arrive. Each node remembers its last rect, and splits, closes and arrangement changes mark their path to the root as dirty, so `update` only descends into subtrees which were touched or whose rect changed. An arrange event with the same metrics as before (as browsers often send while resizing) does nothing.
+ */
+#[derive(Default)]
+pub struct Layout {
+    /** Every node needs laying out, because the metrics changed */
+    all_dirty: bool,
+    metrics: NormalisedMetrics,
+    /** The metrics of the last layout, to tell which grid and graphics windows new metrics resize */
+    old_metrics: NormalisedMetrics,
+    nodes: HashMap<u32, Node>,
+    root: Option<u32>,
+}
+
+struct Node {
+    /** This node, or something below it, needs laying out */
+    dirty: bool,
+    kind: NodeKind,
+    parent: Option<u32>,
+    rect: Rect,
+}
+
+enum NodeKind {
+    Leaf {
+        wintype: u32,
+    },
+    Pair {
+        /** The new window from the split, which gets the split's share */
+        child1: u32,
+        child2: u32,
+        key: Option<u32>,
+        method: u32,
+        size: u32,
+    },
+}
+
+impl Layout {
+    pub fn new() -> Self {
+        Layout::default()
+    }
+
+    pub fn metrics(&self) -> &NormalisedMetrics {
+        &self.metrics
+    }
+
+    /** Set new metrics from an init or arrange event, returning false if nothing changed */
+    pub fn set_metrics(&mut self, metrics: &Metrics) -> bool {
+        let metrics = NormalisedMetrics::from(metrics);
+        if metrics == self.metrics {
+            return false;
+        }
+        if !self.all_dirty {
+            self.old_metrics = self.metrics;
+        }
+        self.metrics = metrics;
+        self.all_dirty = true;
+        true
+    }
+
+    /** Open the root window */
+    pub fn open_root(&mut self, id: u32, wintype: u32) {
+        if self.root.is_some() {
+            panic!("Root window already open");
+        }
+        self.nodes.insert(id, Node::new(NodeKind::Leaf {wintype}, None));
+        self.root = Some(id);
+    }
+
+    /** Split window `split`, putting the new window `id` and `split` into the new pair window `pair` */
+    pub fn split(&mut self, split: u32, id: u32, pair: u32, wintype: u32, method: u32, size: u32) {
+        let parent = self.node(split).parent;
+        self.nodes.insert(pair, Node::new(NodeKind::Pair {
+            child1: id,
+            child2: split,
+            key: Some(id),
+            method,
+            size,
+        }, parent));
+        self.nodes.insert(id, Node::new(NodeKind::Leaf {wintype}, Some(pair)));
+        self.node_mut(split).parent = Some(pair);
+        self.replace_child(parent, split, pair);
+        self.mark_dirty(pair);
+    }
+
+    /** Close a window and everything below it. Its parent pair is also closed, and its sibling takes the pair's place. Returns the IDs of every window removed */
+    pub fn close(&mut self, id: u32) -> Vec<u32> {
+        let mut removed = Vec::new();
+        let parent = self.node(id).parent;
+        self.remove_subtree(id, &mut removed);
+        match parent {
+            None => self.root = None,
+            Some(pair) => {
+                let pair_node = self.nodes.remove(&pair).unwrap();
+                removed.push(pair);
+                let sibling = match pair_node.kind {
+                    NodeKind::Pair {child1, child2, ..} => if child1 == id {child2} else {child1},
+                    NodeKind::Leaf {..} => unreachable!(),
+                };
+                self.node_mut(sibling).parent = pair_node.parent;
+                self.replace_child(pair_node.parent, pair, sibling);
+                self.mark_dirty(sibling);
+            },
+        }
+        // Pairs keyed to a removed window no longer have a key
+        let mut unkeyed = Vec::new();
+        for (&pair, node) in self.nodes.iter_mut() {
+            if let NodeKind::Pair {key, ..} = &mut node.kind {
+                if key.is_some_and(|key| removed.contains(&key)) {
+                    *key = None;
+                    unkeyed.push(pair);
+                }
+            }
+        }
+        for pair in unkeyed {
+            self.mark_dirty(pair);
+        }
+        removed
+    }
+
+    /** Change how a pair window divides its space */
+    pub fn set_arrangement(&mut self, pair: u32, new_method: u32, new_size: u32, new_key: Option<u32>) {
+        if let NodeKind::Pair {key, method, size, ..} = &mut self.node_mut(pair).kind {
+            *key = new_key;
+            *method = new_method;
+            *size = new_size;
+        }
+        else {
+            panic!("Not a pair window");
+        }
+        self.mark_dirty(pair);
+    }
+
+    pub fn rect(&self, id: u32) -> Option<Rect> {
+        self.nodes.get(&id).map(|node| node.rect)
+    }
+
+    /** Lay out whatever needs it, returning the windows whose rects changed */
+    pub fn update(&mut self) -> Vec<u32> {
+        let mut changed = Vec::new();
+        if let Some(root) = self.root {
+            let metrics = &self.metrics;
+            let rect = Rect {
+                height: (metrics.height - 2.0 * metrics.outspacingy).max(0.0),
+                left: metrics.outspacingx,
+                top: metrics.outspacingy,
+                width: (metrics.width - 2.0 * metrics.outspacingx).max(0.0),
+            };
+            self.layout(root, rect, &mut changed);
+        }
+        self.all_dirty = false;
+        changed
+    }
+
+    /** Describe a window for a state update. Pair and blank windows aren't sent to GlkOte */
+    pub fn window_update(&self, id: u32, rock: u32) -> Option<WindowUpdate> {
+        let node = self.nodes.get(&id)?;
+        let rect = node.rect;
+        let metrics = &self.metrics;
+        let mut update = WindowUpdate {
+            graphheight: None,
+            graphwidth: None,
+            gridheight: None,
+            gridwidth: None,
+            height: rect.height,
+            id,
+            left: rect.left,
+            rock,
+            styles: None,
+            top: rect.top,
+            type_: WindowType::Buffer,
+            width: rect.width,
+        };
+        match node.kind {
+            NodeKind::Leaf {wintype: wintype_TextBuffer} => {},
+            NodeKind::Leaf {wintype: wintype_TextGrid} => {
+                update.type_ = WindowType::Grid;
+                let (width, height) = content_size(wintype_TextGrid, rect, metrics);
+                update.gridheight = Some(height);
+                update.gridwidth = Some(width);
+            },
+            NodeKind::Leaf {wintype: wintype_Graphics} => {
+                update.type_ = WindowType::Graphics;
+                let (width, height) = content_size(wintype_Graphics, rect, metrics);
+                update.graphheight = Some(height);
+                update.graphwidth = Some(width);
+            },
+            _ => return None,
+        }
+        Some(update)
+    }
+
+    fn layout(&mut self, id: u32, rect: Rect, changed: &mut Vec<u32>) {
+        let all_dirty = self.all_dirty;
+        let node = self.node(id);
+        if !all_dirty && !node.dirty && node.rect == rect {
+            return;
+        }
+        // New metrics can change how many characters fit in a grid window (or the size of a graphics window's canvas) without moving it
+        let resized = all_dirty && match node.kind {
+            NodeKind::Leaf {wintype} => content_size(wintype, rect, &self.metrics) != content_size(wintype, node.rect, &self.old_metrics),
+            NodeKind::Pair {..} => false,
+        };
+        let node = self.node_mut(id);
+        node.dirty = false;
+        if node.rect != rect || resized {
+            node.rect = rect;
+            changed.push(id);
+        }
+        if let NodeKind::Pair {child1, child2, key, method, size} = node.kind {
+            let (rect1, rect2) = self.split_rect(rect, key, method, size);
+            self.layout(child1, rect1, changed);
+            self.layout(child2, rect2, changed);
+        }
+    }
+
+    /** Divide a pair window's rect between its children */
+    fn split_rect(&self, rect: Rect, key: Option<u32>, method: u32, size: u32) -> (Rect, Rect) {
+        let metrics = &self.metrics;
+        let dir = method & winmethod_DirMask;
+        let vertical = dir == winmethod_Left || dir == winmethod_Right;
+        let backward = dir == winmethod_Left || dir == winmethod_Above;
+        let spacing = if method & winmethod_BorderMask == winmethod_NoBorder {0.0} else if vertical {metrics.inspacingx} else {metrics.inspacingy};
+        let total = if vertical {rect.width} else {rect.height};
+        let available = (total - spacing).max(0.0);
+        let split = if method & winmethod_DivisionMask == winmethod_Fixed {
+            let size = size as f64;
+            let key_type = key.and_then(|key| self.nodes.get(&key)).map(|node| match node.kind {
+                NodeKind::Leaf {wintype} => wintype,
+                NodeKind::Pair {..} => wintype_Pair,
+            });
+            match (key_type, vertical) {
+                (Some(wintype_TextBuffer), true) => size * metrics.buffercharwidth + 2.0 * metrics.buffermarginx,
+                (Some(wintype_TextBuffer), false) => size * metrics.buffercharheight + 2.0 * metrics.buffermarginy,
+                (Some(wintype_TextGrid), true) => size * metrics.gridcharwidth + 2.0 * metrics.gridmarginx,
+                (Some(wintype_TextGrid), false) => size * metrics.gridcharheight + 2.0 * metrics.gridmarginy,
+                (Some(wintype_Graphics), true) => size + 2.0 * metrics.graphicsmarginx,
+                (Some(wintype_Graphics), false) => size + 2.0 * metrics.graphicsmarginy,
+                _ => 0.0,
+            }
+        }
+        else {
+            (available * size as f64 / 100.0).floor()
+        };
+        let split = split.clamp(0.0, available);
+        let rest = available - split;
+        // The first rect is the new window's, on the side the split came from
+        let (first, second) = if backward {(0.0, split + spacing)} else {(rest + spacing, 0.0)};
+        if vertical {
+            (
+                Rect {left: rect.left + first, width: split, ..rect},
+                Rect {left: rect.left + second, width: rest, ..rect},
+            )
+        }
+        else {
+            (
+                Rect {top: rect.top + first, height: split, ..rect},
+                Rect {top: rect.top + second, height: rest, ..rect},
+            )
+        }
+    }
+
+    /** Mark a node and all its ancestors as needing layout */
+    fn mark_dirty(&mut self, mut id: u32) {
+        loop {
+            let node = self.node_mut(id);
+            node.dirty = true;
+            match node.parent {
+                Some(parent) => id = parent,
+                None => break,
+            }
+        }
+    }
+
+    fn node(&self, id: u32) -> &Node {
+        self.nodes.get(&id).expect("Unknown window")
+    }
+
+    fn node_mut(&mut self, id: u32) -> &mut Node {
+        self.nodes.get_mut(&id).expect("Unknown window")
+    }
+
+    fn remove_subtree(&mut self, id: u32, removed: &mut Vec<u32>) {
+        let node = self.nodes.remove(&id).expect("Unknown window");
+        removed.push(id);
+        if let NodeKind::Pair {child1, child2, ..} = node.kind {
+            self.remove_subtree(child1, removed);
+            self.remove_subtree(child2, removed);
+        }
+    }
+
+    /** Point `parent` (or the root) at `new` instead of `old` */
+    fn replace_child(&mut self, parent: Option<u32>, old: u32, new: u32) {
+        match parent {
+            None => self.root = Some(new),
+            Some(parent) => if let NodeKind::Pair {child1, child2, ..} = &mut self.node_mut(parent).kind {
+                if *child1 == old {
+                    *child1 = new;
+                }
+                else if *child2 == old {
+                    *child2 = new;
+                }
+            },
+        }
+    }
+}
+
+/** The size of a grid window in characters, or of a graphics window in pixels. Other windows have no content size */
+fn content_size(wintype: u32, rect: Rect, metrics: &NormalisedMetrics) -> (u32, u32) {
+    match wintype {
+        wintype_TextGrid => (
+            ((rect.width - 2.0 * metrics.gridmarginx) / metrics.gridcharwidth).max(0.0) as u32,
+            ((rect.height - 2.0 * metrics.gridmarginy) / metrics.gridcharheight).max(0.0) as u32,
+        ),
+        wintype_Graphics => (
+            (rect.width - 2.0 * metrics.graphicsmarginx).max(0.0) as u32,
+            (rect.height - 2.0 * metrics.graphicsmarginy).max(0.0) as u32,
+        ),
+        _ => (0, 0),
+    }
+}
+
+impl Node {
+    fn new(kind: NodeKind, parent: Option<u32>) -> Self {
+        Node {
+            dirty: true,
+            kind,
+            parent,
+            // NaN never compares equal, so new nodes are always reported as changed
+            rect: Rect {
+                height: f64::NAN,
+                left: f64::NAN,
+                top: f64::NAN,
+                width: f64::NAN,
+            },
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const BUFFER: u32 = 1;
+    const GRID: u32 = 2;
+    const PAIR: u32 = 3;
+    const GRAPHICS: u32 = 4;
+    const PAIR2: u32 = 5;
+
+    fn metrics(gridcharwidth: f64, graphicsmargin: f64) -> Metrics {
+        Metrics {
+            charheight: Some(10.0),
+            charwidth: Some(5.0),
+            graphicsmargin: Some(graphicsmargin),
+            gridcharwidth: Some(gridcharwidth),
+            height: 400.0,
+            width: 600.0,
+            ..Metrics::default()
+        }
+    }
+
+    #[test]
+    fn metrics_resize_windows_in_place() {
+        let mut layout = Layout::new();
+        layout.set_metrics(&metrics(5.0, 0.0));
+        layout.open_root(BUFFER, wintype_TextBuffer);
+        layout.split(BUFFER, GRID, PAIR, wintype_TextGrid, winmethod_Above | winmethod_Fixed, 1);
+        layout.split(BUFFER, GRAPHICS, PAIR2, wintype_Graphics, winmethod_Left | winmethod_Proportional, 30);
+        layout.update();
+        assert_eq!(layout.window_update(GRID, 0).unwrap().gridwidth, Some(120));
+
+        // Wider grid characters don't move any window, but the grid now has fewer columns
+        layout.set_metrics(&metrics(6.0, 0.0));
+        assert_eq!(layout.update(), [GRID]);
+        assert_eq!(layout.window_update(GRID, 0).unwrap().gridwidth, Some(100));
+
+        // As does a graphics margin for a proportionally sized graphics window
+        let graphwidth = layout.window_update(GRAPHICS, 0).unwrap().graphwidth.unwrap();
+        layout.set_metrics(&metrics(6.0, 10.0));
+        assert_eq!(layout.update(), [GRAPHICS]);
+        assert_eq!(layout.window_update(GRAPHICS, 0).unwrap().graphwidth, Some(graphwidth - 20));
+
+        // Two sets of metrics between layouts are compared against the last layout
+        layout.set_metrics(&metrics(7.0, 10.0));
+        layout.set_metrics(&metrics(6.0, 10.0));
+        assert_eq!(layout.update(), []);
+    }
+}
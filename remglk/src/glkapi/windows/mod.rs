@@ -0,0 +1,30 @@
+/*
+
+Glk Windows
+===========
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+pub mod buffer;
+pub mod graphics;
+pub mod grid;
+pub mod layout;
+pub mod scrollback;
+
+/** A Glk window */
+pub struct GlkWindow {
+    pub data: WindowData,
+    pub disprock: Option<u32>,
+    pub rock: u32,
+}
+
+/** The contents of each type of window */
+pub enum WindowData {
+    Buffer(buffer::BufferWindowText),
+    Graphics(graphics::GraphicsWindow),
+    Grid(grid::GridWindow),
+}
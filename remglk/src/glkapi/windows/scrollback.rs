@@ -0,0 +1,379 @@
+/*
+
+Buffer window scrollback
+========================
+
+Copyright (c) 2022 Dannii Willis
+MIT licenced
+https://github.com/curiousdannii/remglk-rs
+
+*/
+
+use std::collections::VecDeque;
+use std::fs::{File, OpenOptions};
+use std::io::{self, Read, Seek, SeekFrom, Write};
+use std::path::{Path, PathBuf};
+
+use super::super::lz;
+use super::super::protocol::*;
+use super::super::snapshot::*;
+
+/** The default cap on a window's scrollback, in bytes */
+pub const DEFAULT_SCROLLBACK_LIMIT: usize = 1 << 20;
+
+/** Paragraphs already sent to a buffer window, kept for redrawing and autorestore
+ *
+ * Paragraphs are kept in a ring, the oldest being evicted once the text and runs held add up to more than the limit. Eviction frees a quarter of the limit at a time, and if a spill file has been set, the evicted paragraphs are compressed and appended to it as one segment, so that they can still be read back with `read_spilled`.
+ */
+pub struct Scrollback {
+    blocks: VecDeque<Block>,
+    /** Approximate memory used by `blocks` */
+    bytes: usize,
+    limit: usize,
+    spill: Option<Spill>,
+}
+
+struct Block {
+    flowbreak: bool,
+    runs: Vec<BlockRun>,
+    text: String,
+}
+
+struct BlockRun {
+    /** Byte offset of the end of this run in the paragraph's text */
+    end: u32,
+    hyperlink: Option<u32>,
+    style: Style,
+}
+
+struct Spill {
+    file: File,
+    path: PathBuf,
+}
+
+impl Block {
+    fn bytes(&self) -> usize {
+        std::mem::size_of::<Block>() + self.text.len() + self.runs.len() * std::mem::size_of::<BlockRun>()
+    }
+
+    fn to_update(&self) -> BufferWindowParagraphUpdate {
+        let mut start = 0;
+        let content = self.runs.iter().map(|run| {
+            let end = run.end as usize;
+            let text = self.text[start..end].to_string();
+            start = end;
+            LineData::TextRun(TextRun {
+                css_styles: None,
+                hyperlink: run.hyperlink,
+                style: run.style,
+                text,
+            })
+        }).collect();
+        BufferWindowParagraphUpdate {
+            append: None,
+            content: Some(content),
+            flowbreak: if self.flowbreak {Some(true)} else {None},
+        }
+    }
+
+    /** Encode for the spill file: flags, text, then each run's end, hyperlink (0 for none) and style */
+    fn encode(&self, out: &mut Vec<u8>) {
+        out.push(self.flowbreak as u8);
+        out.extend_from_slice(&(self.text.len() as u32).to_le_bytes());
+        out.extend_from_slice(self.text.as_bytes());
+        out.extend_from_slice(&(self.runs.len() as u32).to_le_bytes());
+        for run in &self.runs {
+            out.extend_from_slice(&run.end.to_le_bytes());
+            out.extend_from_slice(&run.hyperlink.unwrap_or(0).to_le_bytes());
+            out.push(run.style as u8);
+        }
+    }
+
+    fn decode(data: &[u8], pos: &mut usize) -> io::Result<Block> {
+        let mut take = |len: usize| -> io::Result<&[u8]> {
+            let bytes = data.get(*pos..*pos + len).ok_or_else(invalid)?;
+            *pos += len;
+            Ok(bytes)
+        };
+        let flowbreak = take(1)?[0] != 0;
+        let text_len = u32::from_le_bytes(take(4)?.try_into().unwrap()) as usize;
+        let text = std::str::from_utf8(take(text_len)?).map_err(|_| invalid())?.to_owned();
+        let run_count = u32::from_le_bytes(take(4)?.try_into().unwrap()) as usize;
+        let mut runs = Vec::with_capacity(run_count.min(text_len + 1));
+        for _ in 0..run_count {
+            let end = u32::from_le_bytes(take(4)?.try_into().unwrap());
+            let hyperlink = u32::from_le_bytes(take(4)?.try_into().unwrap());
+            let style = Style::from_glk(take(1)?[0] as u32).ok_or_else(invalid)?;
+            runs.push(BlockRun {
+                end,
+                hyperlink: if hyperlink == 0 {None} else {Some(hyperlink)},
+                style,
+            });
+        }
+        let block = Block {flowbreak, runs, text};
+        block.validate()?;
+        Ok(block)
+    }
+
+    /** Runs must cover the text in order, on character boundaries */
+    fn validate(&self) -> io::Result<()> {
+        let mut start = 0;
+        for run in &self.runs {
+            let end = run.end as usize;
+            if end < start || !self.text.is_char_boundary(end) {
+                return Err(invalid());
+            }
+            start = end;
+        }
+        if start != self.text.len() {
+            return Err(invalid());
+        }
+        Ok(())
+    }
+}
+
+fn invalid() -> io::Error {
+    io::Error::new(io::ErrorKind::InvalidData, "Invalid scrollback")
+}
+
+impl Default for Scrollback {
+    fn default() -> Self {
+        Scrollback {
+            blocks: VecDeque::new(),
+            bytes: 0,
+            limit: DEFAULT_SCROLLBACK_LIMIT,
+            spill: None,
+        }
+    }
+}
+
+impl Scrollback {
+    pub fn new() -> Self {
+        Scrollback::default()
+    }
+
+    /** Approximate memory used */
+    pub fn bytes(&self) -> usize {
+        self.bytes
+    }
+
+    /** Forget everything, as when the window is cleared */
+    pub fn clear(&mut self) {
+        self.blocks.clear();
+        self.bytes = 0;
+        if let Some(spill) = &mut self.spill {
+            if spill.file.set_len(0).is_err() {
+                self.spill = None;
+            }
+        }
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.blocks.is_empty()
+    }
+
+    /** How many paragraphs are held in memory */
+    pub fn len(&self) -> usize {
+        self.blocks.len()
+    }
+
+    /** Everything held in memory, as paragraphs for redrawing a window after clearing it */
+    pub fn paragraphs(&self) -> Vec<BufferWindowParagraphUpdate> {
+        self.blocks.iter().map(Block::to_update).collect()
+    }
+
+    /** Add a paragraph which has been sent. A paragraph with `append` set continues the last one */
+    pub fn push_paragraph(&mut self, append: bool, flowbreak: bool, text: &str, runs: impl Iterator<Item = (usize, Option<u32>, Style)>) {
+        let block = match self.blocks.back_mut() {
+            Some(block) if append => {
+                self.bytes -= block.bytes();
+                block
+            },
+            _ => {
+                self.blocks.push_back(Block {
+                    flowbreak: false,
+                    runs: Vec::new(),
+                    text: String::new(),
+                });
+                self.blocks.back_mut().unwrap()
+            },
+        };
+        let start = block.text.len();
+        block.flowbreak |= flowbreak;
+        block.text.push_str(text);
+        block.runs.extend(runs.map(|(end, hyperlink, style)| BlockRun {
+            end: (start + end) as u32,
+            hyperlink,
+            style,
+        }));
+        self.bytes += block.bytes();
+        if self.bytes > self.limit {
+            self.evict();
+        }
+    }
+
+    /** Read back the paragraphs which have been spilled to disk, oldest first */
+    pub fn read_spilled(&self) -> io::Result<Vec<BufferWindowParagraphUpdate>> {
+        let mut paragraphs = Vec::new();
+        let spill = match &self.spill {
+            Some(spill) => spill,
+            None => return Ok(paragraphs),
+        };
+        let mut data = Vec::new();
+        File::open(&spill.path)?.read_to_end(&mut data)?;
+        let mut segments = &data[..];
+        let mut raw = Vec::new();
+        while !segments.is_empty() {
+            let header = segments.get(..8).ok_or_else(invalid)?;
+            let raw_len = u32::from_le_bytes(header[..4].try_into().unwrap()) as usize;
+            let compressed_len = u32::from_le_bytes(header[4..].try_into().unwrap()) as usize;
+            let compressed = segments.get(8..8 + compressed_len).ok_or_else(invalid)?;
+            raw.clear();
+            lz::decompress(compressed, raw_len, &mut raw)?;
+            let mut pos = 0;
+            while pos < raw.len() {
+                paragraphs.push(Block::decode(&raw, &mut pos)?.to_update());
+            }
+            segments = &segments[8 + compressed_len..];
+        }
+        Ok(paragraphs)
+    }
+
+    /** Set how much memory (roughly) the scrollback may use, evicting old paragraphs if it is now over */
+    pub fn set_limit(&mut self, limit: usize) {
+        self.limit = limit;
+        if self.bytes > self.limit {
+            self.evict();
+        }
+    }
+
+    /** Spill evicted paragraphs to a file, replacing anything already in it
+     *
+     * If writing to the file ever fails it is given up on, and later evicted paragraphs are just dropped.
+     */
+    pub fn set_spill(&mut self, path: &Path) -> io::Result<()> {
+        let file = OpenOptions::new().create(true).read(true).write(true).truncate(true).open(path)?;
+        self.spill = Some(Spill {
+            file,
+            path: path.to_owned(),
+        });
+        Ok(())
+    }
+
+    /** Restore paragraphs saved by `snapshot`. The limit and spill file aren't saved */
+    pub fn from_snapshot(&mut self, r: &mut SectionReader) -> io::Result<()> {
+        self.blocks.clear();
+        self.bytes = 0;
+        let count = r.usize()?;
+        for _ in 0..count {
+            let flowbreak = r.bool()?;
+            let text = r.str()?.to_owned();
+            let run_count = r.usize()?;
+            let mut runs = Vec::with_capacity(run_count.min(text.len() + 1));
+            for _ in 0..run_count {
+                runs.push(BlockRun {
+                    end: r.u32()?,
+                    hyperlink: r.opt_u32()?,
+                    style: read_name(r, Style::from_name)?,
+                });
+            }
+            let block = Block {flowbreak, runs, text};
+            block.validate()?;
+            self.bytes += block.bytes();
+            self.blocks.push_back(block);
+        }
+        if self.bytes > self.limit {
+            self.evict();
+        }
+        Ok(())
+    }
+
+    /** Save the paragraphs held in memory, but not those spilled to disk */
+    pub fn snapshot(&self, w: &mut SectionWriter) {
+        w.usize(self.blocks.len());
+        for block in &self.blocks {
+            w.bool(block.flowbreak);
+            w.str(&block.text);
+            w.usize(block.runs.len());
+            for run in &block.runs {
+                w.u32(run.end);
+                w.opt_u32(run.hyperlink);
+                w.str(run.style.name());
+            }
+        }
+    }
+
+    /** Evict old paragraphs until we're down to three quarters of the limit, always keeping the last */
+    fn evict(&mut self) {
+        let target = self.limit - self.limit / 4;
+        let mut raw = Vec::new();
+        while self.bytes > target && self.blocks.len() > 1 {
+            let block = self.blocks.pop_front().unwrap();
+            self.bytes -= block.bytes();
+            if self.spill.is_some() {
+                block.encode(&mut raw);
+            }
+        }
+        if let Some(spill) = &mut self.spill {
+            if raw.is_empty() {
+                return;
+            }
+            let mut segment = Vec::with_capacity(raw.len() / 2 + 8);
+            segment.extend_from_slice(&(raw.len() as u32).to_le_bytes());
+            segment.extend_from_slice(&[0; 4]);
+            lz::compress(&raw, &mut segment);
+            let compressed_len = (segment.len() - 8) as u32;
+            segment[4..8].copy_from_slice(&compressed_len.to_le_bytes());
+            if spill.file.seek(SeekFrom::End(0)).and_then(|_| spill.file.write_all(&segment)).is_err() {
+                self.spill = None;
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /** A paragraph's flowbreak, and each run's text, hyperlink and style */
+    fn describe(paragraph: &BufferWindowParagraphUpdate) -> (bool, Vec<(String, Option<u32>, Style)>) {
+        let runs = paragraph.content.as_ref().unwrap().iter().map(|line| match line {
+            LineData::TextRun(run) => (run.text.clone(), run.hyperlink, run.style),
+            _ => panic!("Scrollback paragraphs should only have text runs"),
+        }).collect();
+        (paragraph.flowbreak == Some(true), runs)
+    }
+
+    #[test]
+    fn spill() {
+        let path = std::env::temp_dir().join(format!("remglk-scrollback-test-{}", std::process::id()));
+        let mut scrollback = Scrollback::new();
+        scrollback.set_limit(2048);
+        scrollback.set_spill(&path).unwrap();
+        let mut expected = Vec::new();
+        for i in 0..200u32 {
+            let name = format!("Paragraph {}: ", i);
+            let text = format!("{}You are standing in an open field west of a white house.", name);
+            let hyperlink = if i % 3 == 0 {Some(i + 1)} else {None};
+            scrollback.push_paragraph(false, i % 7 == 0, &text, [(name.len(), None, Style::Header), (text.len(), hyperlink, Style::Normal)].into_iter());
+            expected.push((i % 7 == 0, vec![(name, None, Style::Header), (text[text.find(':').unwrap() + 2..].to_owned(), hyperlink, Style::Normal)]));
+            // Appended text continues the same paragraph
+            if i % 5 == 0 {
+                scrollback.push_paragraph(true, false, " And more.", [(10, None, Style::Emphasized)].into_iter());
+                expected.last_mut().unwrap().1.push((" And more.".to_owned(), None, Style::Emphasized));
+            }
+        }
+        assert!(scrollback.bytes() <= 2048);
+        let spilled = scrollback.read_spilled().unwrap();
+        assert!(!spilled.is_empty());
+        let paragraphs: Vec<_> = spilled.iter().chain(scrollback.paragraphs().iter()).map(describe).collect();
+        assert_eq!(paragraphs.len(), expected.len());
+        for (paragraph, expected) in paragraphs.iter().zip(&expected) {
+            assert_eq!(paragraph, expected);
+        }
+
+        scrollback.clear();
+        assert!(scrollback.read_spilled().unwrap().is_empty());
+        std::fs::remove_file(&path).unwrap();
+    }
+}